@@ -0,0 +1,477 @@
+/*
+ * Copyright (c) 2024 Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rte_host_bench.c
+ * @author  Branko Premzel
+ * @brief   Host computer throughput and contention benchmark of the RTEdbg library.
+ *          The rtedbg.c is compiled with the rtedbg_timer_test.h timer driver and the
+ *          rtedbg_generic_atomic_smp.h CPU driver. N threads log messages with the
+ *          __rte_msg0() ... __rte_msg4(), __rte_msgn(), __rte_msgx() and __rte_stringn()
+ *          at the same time. The following values are reported for each number of threads:
+ *          - messages per second (all threads together),
+ *          - nanoseconds per message (per thread),
+ *          - space reservation retries (CAS loop repetitions - g_rte_reservation_stats),
+ *          - the result of the circular buffer integrity check done after the run.
+ *          Only the configuration of the current build is measured - see the Makefile
+ *          for the builds with the RTE_MINIMIZED_CODE_SIZE, RTE_DELAYED_TSTAMP_READ
+ *          and RTE_BUFFER_SIZE (power of 2 or not) variants.
+ *
+ *          Usage: rte_host_bench [max_threads [loops]]
+ *          The exit code is 1 if the integrity check has found an error.
+ *
+ * @note    The reservation statistics are not updated atomically (see RTE_RESERVATION_STATS).
+ *          A few counts may be lost when several threads log at the same time, so the
+ *          number of attempts may be slightly smaller than the number of messages.
+ *
+ * @version RTEdbg library <DEVELOPMENT BRANCH>
+ ******************************************************************************/
+
+#define _POSIX_C_SOURCE 200809L     // clock_gettime()
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdatomic.h>
+#include <pthread.h>
+#include <time.h>
+#include "rtedbg_int.h"
+
+#define RTE_HB_MAX_THREADS      16U
+#define RTE_HB_DATA_WORDS       (RTE_MAX_MSG_SIZE / 4U)
+#define RTE_HB_MSG_PER_LOOP     8U      // Messages logged by a thread in one loop
+#define RTE_HB_KINDS            11U     // Format ID / 16 - see rte_host_bench_fmt.h
+
+typedef struct
+{
+    pthread_t thread;
+    uint32_t  loops;                            // Number of loops to be executed
+    uint32_t  data[2U * RTE_HB_DATA_WORDS];     // Self-checking DATA words
+} rte_hb_thread_t;
+
+typedef struct
+{
+    uint32_t subpackets;                // Number of checked subpackets
+    uint32_t kind[RTE_HB_KINDS];        // Number of subpackets of each message type
+    uint32_t format_errors;             // No FMT word, unknown message type or wrong size
+    uint32_t data_errors;               // DATA word check failed
+    uint32_t sync_errors;               // Subpacket chain does not end at the write index
+} rte_hb_check_t;
+
+static rte_hb_thread_t rte_hb_threads[RTE_HB_MAX_THREADS];
+static uint8_t rte_hb_bytes[RTE_MAX_MSGX_SIZE];         //!< Data logged with __rte_msgx()
+static char rte_hb_text[RTE_MAX_MSG_SIZE + 4U];         //!< String logged with __rte_stringn()
+static atomic_uint rte_hb_start;                        //!< Set to 1 to start the threads
+
+
+/*********************************************************************************
+ * @brief Self-checking DATA word - the top 8 bits are a hash of the bottom 24 bits.
+ *        All 32 bits are checked, so bit 31 (stored in the FMT word) is tested too.
+ *        The consecutive words of a message contain consecutive 24-bit values.
+ *
+ * @param value  24-bit value
+ *
+ * @return DATA word
+ *********************************************************************************/
+
+static uint32_t rte_hb_word(const uint32_t value)
+{
+    const uint32_t v = value & 0x00FFFFFFU;
+    return v | ((((v * 0x9E3779B1U) >> 24U) ^ 0x5AU) << 24U);
+}
+
+
+static uint64_t rte_hb_time_ns(void)
+{
+    struct timespec ts;
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+
+/*********************************************************************************
+ * @brief Thread that logs RTE_HB_MSG_PER_LOOP messages in each loop.
+ *        The length of the __rte_msgn(), __rte_msgx() and __rte_stringn() messages
+ *        changes from loop to loop.
+ *
+ * @param arg  Thread data (rte_hb_thread_t)
+ *********************************************************************************/
+
+static void *rte_hb_thread(void *arg)
+{
+    const rte_hb_thread_t *t = (const rte_hb_thread_t *)arg;
+    const uint32_t *d = t->data;
+
+    while (atomic_load(&rte_hb_start) == 0U)
+    {
+        // Wait until all threads are ready
+    }
+
+    for (uint32_t i = 0U; i < t->loops; i++)
+    {
+        const uint32_t *p = &d[i % RTE_HB_DATA_WORDS];
+
+        RTE_MSG0(MSG0_HOST_BENCH, F_HOST_BENCH);
+        RTE_MSG1(MSG1_HOST_BENCH, F_HOST_BENCH, p[0]);
+        RTE_MSG2(MSG2_HOST_BENCH, F_HOST_BENCH, p[0], p[1]);
+        RTE_MSG3(MSG3_HOST_BENCH, F_HOST_BENCH, p[0], p[1], p[2]);
+        RTE_MSG4(MSG4_HOST_BENCH, F_HOST_BENCH, p[0], p[1], p[2], p[3]);
+        RTE_MSGN(MSGN_HOST_BENCH, F_HOST_BENCH, p, 1U + ((i * 7U) % RTE_MAX_MSG_SIZE));
+        RTE_MSGX(MSGX_HOST_BENCH, F_HOST_BENCH, rte_hb_bytes, 1U + ((i * 5U) % (RTE_MAX_MSGX_SIZE - 1U)));
+        RTE_STRINGN(MSGN_HOST_STRING, F_HOST_BENCH, &rte_hb_text[i % 4U], (i * 3U) % (RTE_MAX_MSG_SIZE + 1U));
+    }
+
+    return NULL;
+}
+
+
+/*********************************************************************************
+ * @brief Check the contents of the circular buffer after all threads have finished.
+ *        The subpackets are followed from the oldest one (after the write index) to
+ *        the newest one in the same way as they have been written - the next subpacket
+ *        starts at the index limited with RTE_LIMIT_INDEX(). The chain must end
+ *        exactly at the write index. The DATA words of the __rte_msg1() ... __rte_msg4()
+ *        and __rte_msgn() messages are checked word by word, the strings must contain
+ *        only lower case letters and zeros. The size and type of all subpackets are checked.
+ *
+ * @param chk  Check results
+ *********************************************************************************/
+
+static void rte_hb_check_buffer(rte_hb_check_t * const chk)
+{
+    static const uint8_t min_words[RTE_HB_KINDS] = { 5U, 1U, 1U, 0U, 1U, 2U, 3U, 4U, 1U, 1U, 0U };
+    static const uint8_t max_words[RTE_HB_KINDS] = { 0U, 1U, 1U, 0U, 1U, 2U, 3U, 4U, 4U, 4U, 4U };
+    const uint32_t *buffer = g_rtedbg.buffer;
+    uint32_t end = g_rtedbg.buf_index;
+    RTE_LIMIT_INDEX(end)
+
+    *chk = (rte_hb_check_t){ 0U };
+
+    // Skip the rest of the oldest subpacket - its beginning has been overwritten
+    uint32_t skip = 0U;
+    while ((skip < 5U) && ((buffer[end + skip] & 1U) == 0U))
+    {
+        skip++;
+    }
+
+    if (skip == 5U)
+    {
+        chk->format_errors++;
+        return;
+    }
+
+    uint32_t index = end + skip + 1U;
+    RTE_LIMIT_INDEX(index)
+    uint32_t walked = skip + 1U;
+
+    while (index != end)
+    {
+        if (walked > ((uint32_t)(RTE_BUFFER_SIZE) + 4U))
+        {
+            chk->sync_errors++;     // The write index has been passed
+            return;
+        }
+
+        uint32_t n = 0U;
+        while ((n < 4U) && ((buffer[index + n] & 1U) == 0U))
+        {
+            n++;
+        }
+
+        const uint32_t fmt_word = buffer[index + n];
+        if ((fmt_word & 1U) == 0U)
+        {
+            chk->format_errors++;   // Five DATA words - find the next FMT word
+            index++;
+            walked++;
+            RTE_LIMIT_INDEX(index)
+            continue;
+        }
+
+        const uint32_t top = fmt_word >> (32U - (uint32_t)(RTE_FMT_ID_BITS));
+        const uint32_t kind = top >> 4U;
+        uint32_t words[4];
+
+        for (uint32_t j = 0U; j < n; j++)
+        {
+            words[j] = (buffer[index + j] >> 1U) | (((top >> (n - 1U - j)) & 1U) << 31U);
+        }
+
+        chk->subpackets++;
+
+        if ((kind >= RTE_HB_KINDS) || (n < min_words[kind]) || (n > max_words[kind]))
+        {
+            chk->format_errors++;
+        }
+        else
+        {
+            chk->kind[kind]++;
+
+            if ((kind >= (MSG1_HOST_BENCH / 16U)) && (kind <= (MSGN_HOST_BENCH / 16U)))
+            {
+                for (uint32_t j = 0U; j < n; j++)
+                {
+                    if ((words[j] != rte_hb_word(words[j]))
+                        || ((j != 0U) && (((words[j] - words[j - 1U]) & 0x00FFFFFFU) != 1U)))
+                    {
+                        chk->data_errors++;
+                        break;
+                    }
+                }
+            }
+            else if (kind == (MSGN_HOST_STRING / 16U))
+            {
+                for (uint32_t j = 0U; j < (n * 4U); j++)
+                {
+                    const uint8_t c = (uint8_t)(words[j / 4U] >> ((j % 4U) * 8U));
+                    if ((c != 0U) && ((c < (uint8_t)'a') || (c > (uint8_t)'z')))
+                    {
+                        chk->data_errors++;
+                        break;
+                    }
+                }
+            }
+        }
+
+        index += n + 1U;
+        walked += n + 1U;
+        RTE_LIMIT_INDEX(index)
+    }
+}
+
+
+/*********************************************************************************
+ * @brief Check the circular buffer and print the result.
+ *
+ * @return Number of errors found
+ *********************************************************************************/
+
+static uint32_t rte_hb_report_check(void)
+{
+    rte_hb_check_t chk;
+    rte_hb_check_buffer(&chk);
+    const uint32_t errors = chk.format_errors + chk.data_errors + chk.sync_errors;
+
+    printf("  check: %u subpackets (msg0-4 %u/%u/%u/%u/%u, msgn %u, msgx %u, string %u) - %s",
+           chk.subpackets, chk.kind[MSG0_HOST_BENCH / 16U], chk.kind[MSG1_HOST_BENCH / 16U],
+           chk.kind[MSG2_HOST_BENCH / 16U], chk.kind[MSG3_HOST_BENCH / 16U],
+           chk.kind[MSG4_HOST_BENCH / 16U], chk.kind[MSGN_HOST_BENCH / 16U],
+           chk.kind[MSGX_HOST_BENCH / 16U], chk.kind[MSGN_HOST_STRING / 16U],
+           (errors == 0U) ? "ok\n" : "FAILED");
+
+    if (errors != 0U)
+    {
+        printf(" (format %u, data %u, sync %u)\n",
+               chk.format_errors, chk.data_errors, chk.sync_errors);
+    }
+
+    return errors;
+}
+
+
+/*********************************************************************************
+ * @brief Restart the logging and fill the buffer, so that all of it contains valid
+ *        messages when it is checked. The reservation statistics are reset.
+ *********************************************************************************/
+
+static void rte_hb_restart(void)
+{
+    rte_init(RTE_ENABLE_ALL_FILTERS, RTE_RESTART_LOGGING);
+
+    for (uint32_t i = 0U; i < (2U * (uint32_t)(RTE_BUFFER_SIZE)); i++)
+    {
+        RTE_MSG0(MSG0_HOST_BENCH, F_HOST_BENCH);
+    }
+
+    g_rte_reservation_stats.attempts = 0U;
+    g_rte_reservation_stats.retries = 0U;
+    g_rte_reservation_stats.max_retries = 0U;
+}
+
+
+/*********************************************************************************
+ * @brief Execute a statement 'loops' times and print the average time.
+ *********************************************************************************/
+
+#define RTE_HB_MEASURE(name, loops, statement)                                          \
+    {                                                                                   \
+        const uint64_t hb_start = rte_hb_time_ns();                                     \
+        for (uint32_t hb_loop = 0U; hb_loop < (loops); hb_loop++)                       \
+        {                                                                               \
+            statement;                                                                  \
+        }                                                                               \
+        const uint64_t hb_time = rte_hb_time_ns() - hb_start;                           \
+        printf("  %-22s %7.1f ns\n", (name), (double)hb_time / (double)(loops));       \
+    }
+
+
+/*********************************************************************************
+ * @brief Measure the execution times of the logging functions with one thread.
+ *
+ * @param loops  Number of calls of each function
+ *
+ * @return Number of errors found by the buffer check
+ *********************************************************************************/
+
+static uint32_t rte_hb_single_thread(const uint32_t loops)
+{
+    const uint32_t *d = rte_hb_threads[0].data;
+
+    printf("Single thread - time per call:\n");
+    rte_hb_restart();
+
+    RTE_HB_MEASURE("__rte_msg0()", loops, RTE_MSG0(MSG0_HOST_BENCH, F_HOST_BENCH))
+    RTE_HB_MEASURE("__rte_msg1()", loops, RTE_MSG1(MSG1_HOST_BENCH, F_HOST_BENCH, d[0]))
+    RTE_HB_MEASURE("__rte_msg2()", loops, RTE_MSG2(MSG2_HOST_BENCH, F_HOST_BENCH, d[0], d[1]))
+    RTE_HB_MEASURE("__rte_msg3()", loops,
+                   RTE_MSG3(MSG3_HOST_BENCH, F_HOST_BENCH, d[0], d[1], d[2]))
+    RTE_HB_MEASURE("__rte_msg4()", loops,
+                   RTE_MSG4(MSG4_HOST_BENCH, F_HOST_BENCH, d[0], d[1], d[2], d[3]))
+
+    uint32_t filter = rte_get_filter();
+    rte_set_filter(filter & ~(0x80000000UL >> (uint32_t)(F_HOST_BENCH)));
+    RTE_HB_MEASURE("__rte_msg4() filtered", loops,
+                   RTE_MSG4(MSG4_HOST_BENCH, F_HOST_BENCH, d[0], d[1], d[2], d[3]))
+    rte_set_filter(filter);
+
+    for (uint32_t size = 16U; size <= RTE_MAX_MSG_SIZE; size *= 4U)
+    {
+        char name[32];
+        (void)snprintf(name, sizeof(name), "__rte_msgn() %u B", size);
+        RTE_HB_MEASURE(name, loops, RTE_MSGN(MSGN_HOST_BENCH, F_HOST_BENCH, d, size))
+    }
+
+    for (uint32_t size = 16U; size <= RTE_MAX_MSGX_SIZE; size *= 4U)
+    {
+        char name[32];
+        (void)snprintf(name, sizeof(name), "__rte_msgx() %u B", size - 1U);
+        RTE_HB_MEASURE(name, loops, RTE_MSGX(MSGX_HOST_BENCH, F_HOST_BENCH, rte_hb_bytes, size - 1U))
+    }
+
+    for (uint32_t size = 16U; size <= RTE_MAX_MSG_SIZE; size *= 4U)
+    {
+        char name[32];
+        (void)snprintf(name, sizeof(name), "__rte_stringn() %u B", size);
+        RTE_HB_MEASURE(name, loops, RTE_STRINGN(MSGN_HOST_STRING, F_HOST_BENCH, rte_hb_text, size))
+    }
+
+    return rte_hb_report_check();
+}
+
+
+/*********************************************************************************
+ * @brief Log messages with several threads at the same time and print the results.
+ *
+ * @param threads  Number of threads
+ * @param loops    Number of loops executed by each thread
+ *
+ * @return Number of errors found by the buffer check
+ *********************************************************************************/
+
+static uint32_t rte_hb_multi_thread(const uint32_t threads, const uint32_t loops)
+{
+    rte_hb_restart();
+    atomic_store(&rte_hb_start, 0U);
+
+    for (uint32_t i = 0U; i < threads; i++)
+    {
+        rte_hb_threads[i].loops = loops;
+        if (pthread_create(&rte_hb_threads[i].thread, NULL, rte_hb_thread, &rte_hb_threads[i]) != 0)
+        {
+            fprintf(stderr, "Thread #%u could not be created.\n", i);
+            exit(2);
+        }
+    }
+
+    const uint64_t start = rte_hb_time_ns();
+    atomic_store(&rte_hb_start, 1U);
+
+    for (uint32_t i = 0U; i < threads; i++)
+    {
+        (void)pthread_join(rte_hb_threads[i].thread, NULL);
+    }
+
+    const double time_ns = (double)(rte_hb_time_ns() - start);
+    const double messages = (double)threads * (double)loops * (double)RTE_HB_MSG_PER_LOOP;
+    const uint32_t attempts = g_rte_reservation_stats.attempts;
+    const uint32_t retries = g_rte_reservation_stats.retries;
+
+    printf("%2u thread(s): %12.0f msg/s %8.1f ns/msg, reservations %u, retries %u"
+           " (%.4f per reservation, max %u)\n",
+           threads, messages * 1e9 / time_ns, time_ns * (double)threads / messages,
+           attempts, retries, (attempts == 0U) ? 0.0 : ((double)retries / (double)attempts),
+           g_rte_reservation_stats.max_retries);
+
+    return rte_hb_report_check();
+}
+
+
+int main(int argc, char *argv[])
+{
+    uint32_t max_threads = 4U;
+    uint32_t loops = 100000U;
+
+    if (argc > 1)
+    {
+        max_threads = (uint32_t)strtoul(argv[1], NULL, 0);
+    }
+
+    if (argc > 2)
+    {
+        loops = (uint32_t)strtoul(argv[2], NULL, 0);
+    }
+
+    if ((max_threads == 0U) || (max_threads > RTE_HB_MAX_THREADS) || (loops == 0U))
+    {
+        fprintf(stderr, "Usage: %s [max_threads (1 ... %u) [loops]]\n", argv[0], RTE_HB_MAX_THREADS);
+        return 2;
+    }
+
+    for (uint32_t i = 0U; i < RTE_HB_MAX_THREADS; i++)
+    {
+        for (uint32_t j = 0U; j < (2U * RTE_HB_DATA_WORDS); j++)
+        {
+            rte_hb_threads[i].data[j] = rte_hb_word((i << 20U) + j);
+        }
+    }
+
+    for (uint32_t i = 0U; i < RTE_MAX_MSGX_SIZE; i++)
+    {
+        rte_hb_bytes[i] = (uint8_t)i;
+    }
+
+    for (uint32_t i = 0U; i < (RTE_MAX_MSG_SIZE + 3U); i++)
+    {
+        rte_hb_text[i] = (char)('a' + (i % 26U));
+    }
+    rte_hb_text[RTE_MAX_MSG_SIZE + 3U] = '\0';
+
+    printf("RTE_BUFFER_SIZE %u (%s), RTE_MINIMIZED_CODE_SIZE %u, RTE_DELAYED_TSTAMP_READ %u, %s\n",
+           (uint32_t)(RTE_BUFFER_SIZE),
+           RTE_IS_POWER_OF_2((RTE_BUFFER_SIZE)) ? "power of 2" : "not a power of 2",
+           (uint32_t)(RTE_MINIMIZED_CODE_SIZE), (uint32_t)(RTE_DELAYED_TSTAMP_READ), RTE_CPU_DRIVER);
+
+    uint32_t errors = rte_hb_single_thread(loops);
+
+    // 1, 2, 4 ... threads and max_threads
+    for (uint32_t threads = 1U; threads != 0U; )
+    {
+        errors += rte_hb_multi_thread(threads, loops);
+
+        if (threads == max_threads)
+        {
+            threads = 0U;
+        }
+        else
+        {
+            threads = ((threads * 2U) > max_threads) ? max_threads : (threads * 2U);
+        }
+    }
+
+    printf("\n");
+    return (errors == 0U) ? 0 : 1;
+}
+
+/*==== End of file ====*/
@@ -0,0 +1,35 @@
+#ifndef RTE_RTE_HOST_BENCH_FMT_H
+#define RTE_RTE_HOST_BENCH_FMT_H
+/* "rte_host_bench_fmt.h" - Filter and format IDs for the host benchmark (rte_host_bench.c)  */
+/* The values are defined directly - the buffer contents are checked by the benchmark itself */
+/* and not decoded with RTEmsg. Every format ID is a multiple of 16, so the message type can  */
+/* be determined from the top (RTE_FMT_ID_BITS - 4) bits of the FMT word of every subpacket.   */
+
+// FILTER(F_SYSTEM, "System and other important messages")
+#define F_SYSTEM                0U
+// FILTER(F_HOST_BENCH, "Host benchmark messages")
+#define F_HOST_BENCH            1U
+
+// MSG1_TSTAMP_FREQUENCY "Timestamp frequency: %[32u](*1e-6)g MHz"
+#define MSG1_TSTAMP_FREQUENCY   16U
+// MSG1_LONG_TIMESTAMP   "0x%X"
+#define MSG1_LONG_TIMESTAMP     32U
+
+// MSG0_HOST_BENCH "msg0"
+#define MSG0_HOST_BENCH         48U
+// MSG1_HOST_BENCH "msg1 %X"
+#define MSG1_HOST_BENCH         64U
+// MSG2_HOST_BENCH "msg2 %X %X"
+#define MSG2_HOST_BENCH         80U
+// MSG3_HOST_BENCH "msg3 %X %X %X"
+#define MSG3_HOST_BENCH         96U
+// MSG4_HOST_BENCH "msg4 %X %X %X %X"
+#define MSG4_HOST_BENCH         112U
+// MSGN_HOST_BENCH "msgn"
+#define MSGN_HOST_BENCH         128U
+// MSGX_HOST_BENCH "msgx"
+#define MSGX_HOST_BENCH         144U
+// MSGN_HOST_STRING "%s"
+#define MSGN_HOST_STRING        160U
+
+#endif
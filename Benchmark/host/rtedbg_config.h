@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2024 Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rtedbg_config.h
+ * @author  Branko Premzel
+ * @version RTEdbg library <DEVELOPMENT BRANCH>
+ * @brief   Configuration of the host benchmark (rte_host_bench.c).
+ *          The options compared by the benchmark can be set on the compiler
+ *          command line - see the Makefile.
+ ******************************************************************************/
+
+#ifndef RTEDBG_CONFIG_H
+#define RTEDBG_CONFIG_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include <stdint.h>
+#include <stddef.h>
+#include "rte_host_bench_fmt.h"     // Filter and format ID values
+
+
+/*******************************************************************************
+ * Drivers - the test timer counts the messages (reproducible timestamps) and the
+ * C11 atomic operations make the logging functions thread safe.
+ ******************************************************************************/
+#define RTE_TIMER_DRIVER        "rtedbg_timer_test.h"
+#define RTE_GET_TSTAMP_FREQUENCY()  1000000U
+#define RTE_TIMESTAMP_SHIFT     1U
+
+#if !defined RTE_CPU_DRIVER
+#define RTE_CPU_DRIVER          "rtedbg_generic_atomic_smp.h"
+#endif
+
+
+/*******************************************************************************
+ * Data logging options
+ ******************************************************************************/
+#define RTE_ENABLED                     1
+#define RTE_FMT_ID_BITS                 10
+
+#if !defined RTE_BUFFER_SIZE
+#define RTE_BUFFER_SIZE                 8192U
+#endif
+
+#define RTE_MAX_SUBPACKETS              16U
+#define RTE_MSG_FILTERING_ENABLED       1
+#define RTE_FILTER_OFF_ENABLED          1
+#define RTE_FIRMWARE_MAY_SET_FILTER     1
+
+#if !defined RTE_MINIMIZED_CODE_SIZE
+#define RTE_MINIMIZED_CODE_SIZE         0
+#endif
+
+#if !defined RTE_DELAYED_TSTAMP_READ
+#define RTE_DELAYED_TSTAMP_READ         1
+#endif
+
+#define RTE_USE_LONG_TIMESTAMP          0   // The test timer counter is not thread safe
+#define RTE_SINGLE_SHOT_ENABLED         0
+#define RTE_DISCARD_TOO_LONG_MESSAGES   1
+#define RTE_RESERVATION_STATS           1   // CAS retry counters (g_rte_reservation_stats)
+#define RTE_COMPILE_TIME_PARAMETER_CHECK
+
+#define RTE_DBG_RAM                         // No special memory section on a host
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  // RTEDBG_CONFIG_H
+
+/*==== End of file ====*/
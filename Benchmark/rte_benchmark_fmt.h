@@ -0,0 +1,26 @@
+#ifndef RTE_RTE_BENCHMARK_FMT_H
+#define RTE_RTE_BENCHMARK_FMT_H
+/* "rte_benchmark_fmt.h" - Format definitions for the RTEdbg benchmark (rtedbg_benchmark.c) */
+/* Add INCLUDE("rte_benchmark_fmt.h") to the rte_main_fmt.h of the benchmark project.      */
+
+// FILTER(F_BENCH_DATA, "Benchmark - messages logged during the time measurement")
+// FILTER(F_BENCH_RESULTS, "Benchmark - measurement results")
+
+/* Messages logged during the time measurement - the contents are not important */
+// MSG0_BENCH "msg0"
+// MSG1_BENCH "msg1 %u"
+// MSG2_BENCH "msg2 %u %u"
+// MSG3_BENCH "msg3 %u %u %u"
+// MSG4_BENCH "msg4 %u %u %u %u"
+// MSGN_BENCH_DATA "msgn"
+// MSGX_BENCH_DATA "msgx"
+// MSGN_BENCH_STRING "stringn %s"
+
+/* Benchmark results */
+// MSGN_BENCH_CPU_DRIVER "\nCPU driver: %s"
+// MSGN_BENCH_COMPILER "\nCompiler: %s"
+// MSG3_BENCH_CONFIG "\nOptions: 0x%X, loops: %u, measurement overhead: %u cycles"
+/* Options: bit 0 - RTE_MINIMIZED_CODE_SIZE, bit 1 - RTE_DELAYED_TSTAMP_READ, bit 2 - RTE_MSG_FILTERING_ENABLED */
+// MSG4_BENCH_RESULT "\nTest 0x%05X: min %u, avg %u, max %u cycles"
+/* Test = entry point (bits 16..19) and payload size in bytes (bits 0..15) - see rtedbg_benchmark.h */
+#endif
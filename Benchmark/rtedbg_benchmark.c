@@ -0,0 +1,148 @@
+/*
+ * Copyright (c) 2024 Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rtedbg_benchmark.c
+ * @author  Branko Premzel
+ * @brief   On-target execution time measurement of the RTEdbg data logging functions.
+ *          Add this file, the rtedbg_benchmark_inline.c and the rte_benchmark_fmt.h
+ *          to the project and call rte_benchmark() after rte_init(), e.g.
+ *              rte_init(RTE_ENABLE_ALL_FILTERS, RTE_FORCE_ENABLE_ALL_FILTERS);
+ *              rte_benchmark(1000U);
+ *          Then transfer the buffer contents to the host and decode it with RTEmsg.
+ *          The results are logged at the end - they are not overwritten by the messages
+ *          logged during the measurements.
+ *
+ * @note    Interrupts and DMA transfers increase the maximal times. Disable the
+ *          interrupts that are not needed for the benchmark to get repeatable values.
+ *          The minimum and average times depend also on the instruction and data
+ *          caches, flash wait states and memory in which g_rtedbg is located.
+ *
+ * @version RTEdbg library <DEVELOPMENT BRANCH>
+ ******************************************************************************/
+
+#include "rtedbg_benchmark.h"
+
+#if RTE_ENABLED != 0
+
+static rte_bench_result_t rte_bench_results[RTE_BENCH_MAX_RESULTS];
+static uint32_t rte_bench_data[RTE_MAX_MSG_SIZE / 4U];  //!< Data logged with __rte_msgn/msgx()
+static char rte_bench_text[RTE_MAX_MSG_SIZE + 1U];      //!< String logged with __rte_stringn()
+
+
+/*********************************************************************************
+ * @brief Measure the execution times of the called __rte_msg0() ... __rte_msg4().
+ *
+ * @param results  Array for five results
+ * @param loops    Number of measurements for each function
+ * @param test     RTE_BENCH_MSG or RTE_BENCH_MSG_FILTERED
+ *********************************************************************************/
+
+static void rte_bench_msg(rte_bench_result_t * const results, const uint32_t loops,
+                          const uint32_t test)
+{
+    const uint32_t data1 = rte_bench_data[0];
+    const uint32_t data2 = rte_bench_data[1];
+    const uint32_t data3 = rte_bench_data[2];
+    const uint32_t data4 = rte_bench_data[3];
+
+    RTE_BENCH_MEASURE(&results[0], test | 0U, loops,
+                      RTE_MSG0(MSG0_BENCH, F_BENCH_DATA))
+    RTE_BENCH_MEASURE(&results[1], test | 4U, loops,
+                      RTE_MSG1(MSG1_BENCH, F_BENCH_DATA, data1))
+    RTE_BENCH_MEASURE(&results[2], test | 8U, loops,
+                      RTE_MSG2(MSG2_BENCH, F_BENCH_DATA, data1, data2))
+    RTE_BENCH_MEASURE(&results[3], test | 12U, loops,
+                      RTE_MSG3(MSG3_BENCH, F_BENCH_DATA, data1, data2, data3))
+    RTE_BENCH_MEASURE(&results[4], test | 16U, loops,
+                      RTE_MSG4(MSG4_BENCH, F_BENCH_DATA, data1, data2, data3, data4))
+}
+
+
+/*********************************************************************************
+ * @brief Measure the execution times of the logging functions and log the results.
+ *        The results are corrected for the time needed to read the cycle counter.
+ *
+ * @param loops  Number of measurements for each function and payload size
+ *********************************************************************************/
+
+void rte_benchmark(const uint32_t loops)
+{
+    if (loops == 0U)
+    {
+        return;
+    }
+
+    RTE_BENCH_INIT_CYCLES();
+
+    for (uint32_t i = 0U; i < (RTE_MAX_MSG_SIZE / 4U); i++)
+    {
+        rte_bench_data[i] = i * 0x01010101U;
+    }
+
+    for (uint32_t i = 0U; i < RTE_MAX_MSG_SIZE; i++)
+    {
+        rte_bench_text[i] = (char)('A' + (i % 26U));
+    }
+    rte_bench_text[RTE_MAX_MSG_SIZE] = '\0';
+
+    rte_bench_result_t *result = rte_bench_results;
+    RTE_BENCH_MEASURE(result, RTE_BENCH_OVERHEAD, loops, (void)0)
+    result++;
+
+    rte_bench_msg(result, loops, RTE_BENCH_MSG);
+    result += 5U;
+    result += rte_benchmark_inline(result, loops);
+
+#if RTE_MSG_FILTERING_ENABLED != 0
+    uint32_t filter = rte_get_filter();
+    rte_set_filter(filter & ~(0x80000000UL >> (uint32_t)(F_BENCH_DATA)));
+    rte_bench_msg(result, loops, RTE_BENCH_MSG_FILTERED);
+    rte_set_filter(filter);
+    result += 5U;
+#endif
+
+    for (uint32_t size = 4U; size <= RTE_MAX_MSG_SIZE; size *= 2U)
+    {
+        RTE_BENCH_MEASURE(result, RTE_BENCH_MSGN | size, loops,
+                          RTE_MSGN(MSGN_BENCH_DATA, F_BENCH_DATA, rte_bench_data, size))
+        result++;
+    }
+
+    for (uint32_t size = 1U; size < RTE_MAX_MSGX_SIZE; size *= 2U)
+    {
+        RTE_BENCH_MEASURE(result, RTE_BENCH_MSGX | size, loops,
+                          RTE_MSGX(MSGX_BENCH_DATA, F_BENCH_DATA, rte_bench_data, size))
+        result++;
+    }
+
+    for (uint32_t size = 4U; size <= RTE_MAX_MSG_SIZE; size *= 2U)
+    {
+        RTE_BENCH_MEASURE(result, RTE_BENCH_STRINGN | size, loops,
+                          RTE_STRINGN(MSGN_BENCH_STRING, F_BENCH_DATA, rte_bench_text, size))
+        result++;
+    }
+
+    // Log the configuration and the results
+    const uint32_t overhead = rte_bench_results[0].min;
+    const uint32_t options = (((RTE_MINIMIZED_CODE_SIZE) != 0) ? 1U : 0U)
+                           | (((RTE_DELAYED_TSTAMP_READ) != 0) ? 2U : 0U)
+                           | (((RTE_MSG_FILTERING_ENABLED) != 0) ? 4U : 0U);
+    RTE_STRING(MSGN_BENCH_CPU_DRIVER, F_BENCH_RESULTS, RTE_CPU_DRIVER);
+    RTE_STRING(MSGN_BENCH_COMPILER, F_BENCH_RESULTS, RTE_BENCH_COMPILER);
+    RTE_MSG3(MSG3_BENCH_CONFIG, F_BENCH_RESULTS, options, loops, overhead);
+
+    for (const rte_bench_result_t *p = &rte_bench_results[1]; p < result; p++)
+    {
+        uint32_t average = (uint32_t)(p->sum / loops);
+        RTE_MSG4(MSG4_BENCH_RESULT, F_BENCH_RESULTS, p->test_id,
+                 p->min - overhead, average - overhead, p->max - overhead);
+    }
+}
+
+#endif // RTE_ENABLED != 0
+
+/*==== End of file ====*/
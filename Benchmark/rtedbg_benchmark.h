@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2024 Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rtedbg_benchmark.h
+ * @author  Branko Premzel
+ * @brief   On-target execution time measurement of the RTEdbg data logging functions.
+ *          The rte_benchmark() measures the minimum, average and maximum number of
+ *          CPU cycles for the called and inline versions of __rte_msg0() ... __rte_msg4(),
+ *          for __rte_msgn(), __rte_msgx() and __rte_stringn() with different payload
+ *          sizes and for the messages discarded by the message filter. The results are
+ *          logged with RTEdbg - see rte_benchmark_fmt.h.
+ *          Only the configuration of the current build is measured. Rebuild the benchmark
+ *          for each CPU driver and configuration (RTE_MINIMIZED_CODE_SIZE, etc.) of
+ *          interest. The CPU driver name, compiler version and options are logged
+ *          together with the results.
+ *
+ * @note    By default, the CPU cycles are counted with the DWT->CYCCNT counter (Cortex-M3,
+ *          M4, M7, M33, ...). Define RTE_BENCH_CYCLES() in the rtedbg_config.h to use
+ *          another counter - e.g. rte_get_timestamp() if the timestamp timer runs with
+ *          the CPU clock. The RTE_TIMER_DRIVER is then included by this file.
+ *
+ * @version RTEdbg library <DEVELOPMENT BRANCH>
+ ******************************************************************************/
+
+#ifndef RTEDBG_BENCHMARK_H
+#define RTEDBG_BENCHMARK_H
+
+#include "rtedbg.h"
+#include "rte_benchmark_fmt.h"    // Benchmark filter and format ID definitions
+
+#if !defined RTE_BENCH_CYCLES
+#define RTE_BENCH_CYCLES()      (DWT->CYCCNT)
+#define RTE_BENCH_INIT_CYCLES()                                                         \
+    {                                                                                   \
+        CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;                                 \
+        DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;                                            \
+    }
+#elif (RTE_ENABLED != 0) && !defined RTEDBG_INLINE_H
+/* The counter defined in the rtedbg_config.h may use the timestamp timer driver
+ * functions - e.g. rte_get_timestamp(). The driver is included as in rtedbg_inline.h.
+ */
+#define RTE_USE_INLINE_FUNCTIONS
+#include "rtedbg_int.h"
+#include RTE_TIMER_DRIVER           // Timestamp timer driver
+#endif
+
+#if !defined RTE_BENCH_INIT_CYCLES
+#define RTE_BENCH_INIT_CYCLES()
+#endif
+
+// Prevents the compiler from moving the inline logging code out of the measured interval.
+#if !defined RTE_BENCH_BARRIER
+#define RTE_BENCH_BARRIER()     __asm volatile ("" ::: "memory")
+#endif
+
+#if !defined RTE_BENCH_COMPILER
+#if defined __VERSION__
+#define RTE_BENCH_COMPILER      __VERSION__
+#else
+#define RTE_BENCH_COMPILER      "unknown"
+#endif
+#endif
+
+// Test ID = entry point (bits 16..19) | payload size in bytes (bits 0..15)
+#define RTE_BENCH_OVERHEAD      0x00000U    // Two cycle counter reads (subtracted from the results)
+#define RTE_BENCH_MSG           0x10000U    // __rte_msg0() ... __rte_msg4() - called (size = 0 ... 16)
+#define RTE_BENCH_MSG_INLINE    0x20000U    // __rte_msg0() ... __rte_msg4() - inline (rtedbg_inline.h)
+#define RTE_BENCH_MSG_FILTERED  0x30000U    // __rte_msg0() ... __rte_msg4() - discarded by the filter
+#define RTE_BENCH_MSGN          0x40000U    // __rte_msgn()
+#define RTE_BENCH_MSGX          0x50000U    // __rte_msgx()
+#define RTE_BENCH_STRINGN       0x60000U    // __rte_stringn()
+
+#define RTE_BENCH_MAX_RESULTS   48U         // Number of results stored by rte_benchmark()
+
+typedef struct
+{
+    uint32_t test_id;       // Entry point and payload size
+    uint32_t min;           // Minimal execution time [CPU cycles]
+    uint32_t max;           // Maximal execution time
+    uint64_t sum;           // Sum of all execution times
+} rte_bench_result_t;
+
+
+/*********************************************************************************
+ * @brief Execute a statement 'loops' times and store its min/max/total execution time.
+ *
+ * @param result     Result structure
+ * @param id         Test ID
+ * @param loops      Number of measurements
+ * @param statement  Measured statement
+ *********************************************************************************/
+
+#define RTE_BENCH_MEASURE(result, id, loops, statement)                                 \
+    {                                                                                   \
+        (result)->test_id = (id);                                                       \
+        (result)->min = 0xFFFFFFFFU;                                                    \
+        (result)->max = 0U;                                                             \
+        (result)->sum = 0U;                                                             \
+        for (uint32_t bench_loop = 0U; bench_loop < (loops); bench_loop++)              \
+        {                                                                               \
+            RTE_BENCH_BARRIER();                                                        \
+            uint32_t bench_time = RTE_BENCH_CYCLES();                                   \
+            RTE_BENCH_BARRIER();                                                        \
+            statement;                                                                  \
+            RTE_BENCH_BARRIER();                                                        \
+            bench_time = RTE_BENCH_CYCLES() - bench_time;                               \
+            RTE_BENCH_BARRIER();                                                        \
+            if (bench_time < (result)->min) { (result)->min = bench_time; }             \
+            if (bench_time > (result)->max) { (result)->max = bench_time; }             \
+            (result)->sum += bench_time;                                                \
+        }                                                                               \
+    }
+
+#if RTE_ENABLED != 0
+void rte_benchmark(const uint32_t loops);
+uint32_t rte_benchmark_inline(rte_bench_result_t * const results, const uint32_t loops);
+#else
+#define rte_benchmark(loops)
+#endif
+
+#endif  // RTEDBG_BENCHMARK_H
+
+/*==== End of file ====*/
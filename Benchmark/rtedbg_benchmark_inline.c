@@ -0,0 +1,55 @@
+/*
+ * Copyright (c) 2024 Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rtedbg_benchmark_inline.c
+ * @author  Branko Premzel
+ * @brief   Execution time measurement of the inline versions of the __rte_msg0() ...
+ *          __rte_msg4() functions (rtedbg_inline.h). The file must be compiled
+ *          separately from the rtedbg_benchmark.c, which measures the called versions.
+ *          Compile it with the same optimization settings as the application code
+ *          that uses the inline logging.
+ *
+ * @version RTEdbg library <DEVELOPMENT BRANCH>
+ ******************************************************************************/
+
+#include "rtedbg_inline.h"
+#include "rtedbg_benchmark.h"
+
+#if RTE_ENABLED != 0
+
+/*********************************************************************************
+ * @brief Measure the execution times of the inline __rte_msg0() ... __rte_msg4().
+ *
+ * @param results  Array for at least five results
+ * @param loops    Number of measurements for each function
+ *
+ * @return Number of results stored
+ *********************************************************************************/
+
+uint32_t rte_benchmark_inline(rte_bench_result_t * const results, const uint32_t loops)
+{
+    const uint32_t data1 = loops;
+    const uint32_t data2 = loops + 1U;
+    const uint32_t data3 = loops + 2U;
+    const uint32_t data4 = loops + 3U;
+
+    RTE_BENCH_MEASURE(&results[0], RTE_BENCH_MSG_INLINE | 0U, loops,
+                      RTE_MSG0(MSG0_BENCH, F_BENCH_DATA))
+    RTE_BENCH_MEASURE(&results[1], RTE_BENCH_MSG_INLINE | 4U, loops,
+                      RTE_MSG1(MSG1_BENCH, F_BENCH_DATA, data1))
+    RTE_BENCH_MEASURE(&results[2], RTE_BENCH_MSG_INLINE | 8U, loops,
+                      RTE_MSG2(MSG2_BENCH, F_BENCH_DATA, data1, data2))
+    RTE_BENCH_MEASURE(&results[3], RTE_BENCH_MSG_INLINE | 12U, loops,
+                      RTE_MSG3(MSG3_BENCH, F_BENCH_DATA, data1, data2, data3))
+    RTE_BENCH_MEASURE(&results[4], RTE_BENCH_MSG_INLINE | 16U, loops,
+                      RTE_MSG4(MSG4_BENCH, F_BENCH_DATA, data1, data2, data3, data4))
+    return 5U;
+}
+
+#endif // RTE_ENABLED != 0
+
+/*==== End of file ====*/
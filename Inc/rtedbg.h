@@ -22,6 +22,71 @@
 #include "rtedbg_config.h"  // Project-specific configuration file.
 #include "rte_system_fmt.h" // System message filter and format ID definitions
 
+/* Default values of the optional configuration macros (see rtedbg_config_template.h). */
+#if !defined RTE_SMP_CORES
+#define RTE_SMP_CORES  1U
+#endif
+
+#if !defined RTE_STREAMING_ENABLED
+#define RTE_STREAMING_ENABLED  0
+#endif
+
+#if !defined RTE_STREAM_DMA_ENABLED
+#define RTE_STREAM_DMA_ENABLED  0
+#endif
+
+#if !defined RTE_RESERVATION_STATS
+#define RTE_RESERVATION_STATS  0
+#endif
+
+#if !defined RTE_LOSS_STATS
+#define RTE_LOSS_STATS  0
+#endif
+
+#if !defined RTE_DEFERRED_ERASE
+#define RTE_DEFERRED_ERASE  0
+#endif
+
+#if !defined RTE_CHANNELS
+#define RTE_CHANNELS  1U
+#endif
+
+#if !defined RTE_GROUP_DECIMATION
+#define RTE_GROUP_DECIMATION  0
+#endif
+
+#if !defined RTE_GROUP_WORD_STATS
+#define RTE_GROUP_WORD_STATS  0
+#endif
+
+#if !defined RTE_TRIGGER_ENABLED
+#define RTE_TRIGGER_ENABLED  0
+#endif
+
+#if !defined RTE_WRITE_POSITION
+#define RTE_WRITE_POSITION  0
+#endif
+
+#if !defined RTE_AUTO_LONG_TIMESTAMP
+#define RTE_AUTO_LONG_TIMESTAMP  0
+#endif
+
+#if !defined RTE_SHARED_RTEDBG
+#define RTE_SHARED_RTEDBG  0
+#endif
+
+#if !defined RTE_CACHE_LINE_SIZE
+#define RTE_CACHE_LINE_SIZE  0U
+#endif
+
+#if !defined RTE_FLASH_PERSIST
+#define RTE_FLASH_PERSIST  0
+#endif
+
+#if !defined RTE_DUAL_BANK
+#define RTE_DUAL_BANK  0
+#endif
+
 
 #ifdef __cplusplus
 extern "C" {
@@ -41,6 +106,21 @@ extern "C" {
         /* Enable single shot logging and clear the circular buffer */
 #endif
 
+#if RTE_TRIGGER_ENABLED != 0
+/****** Trigger mode states (g_rte_trigger.state) ******/
+#define RTE_TRIGGER_OFF        0U
+        /* Trigger mode not active - normal post-mortem or single shot logging */
+#define RTE_TRIGGER_ARMED      1U
+        /* Circular logging until rte_trigger() is called or the trigger format ID is logged */
+#define RTE_TRIGGER_POST       2U
+        /* Triggered - logging the post-trigger part of the data */
+#define RTE_TRIGGER_DONE       3U
+        /* Post-trigger data logged - message logging has been stopped (filter = 0) */
+
+#define RTE_TRIGGER_NO_FMT     0xFFFFFFFFU
+        /* rte_trigger_arm() parameter - trigger only with the rte_trigger() call */
+#endif
+
 
 /************************ COMMON DEFINITIONS ***************************/
         
@@ -63,6 +143,60 @@ extern "C" {
 
 #define RTE_ERASED_STATE  0xFFFFFFFFU    // Erased state of the circular buffer.
 
+// Maximum number of messages logged with a single RTE_MSG_BATCH() call.
+#if (RTE_MAX_SUBPACKETS) > 32U
+#define RTE_MAX_BATCH_MESSAGES  32U
+#else
+#define RTE_MAX_BATCH_MESSAGES  ((uint32_t)(RTE_MAX_SUBPACKETS))
+#endif
+
+/* Description of one message logged with RTE_MSG_BATCH().
+ * Initialize it with one of the RTE_BATCH_MSG0() ... RTE_BATCH_MSG4() macros.
+ */
+typedef struct
+{
+    uint32_t fmt_id;    // Format ID and filter number packed with RTE_PACK(filter_no, fmt, 0U)
+    uint32_t size;      // Number of data words (0 ... 4)
+    uint32_t data[4];   // Data words - use float_par() for float values
+} rte_batch_msg_t;
+
+/* Context of the delta-encoded array messages logged with RTE_DELTA_MSG().
+ * Define one for each logged array and initialize it before the first message.
+ * Example:
+ *    static uint32_t adc_prev[16];
+ *    static rte_delta_ctx_t adc_ctx = { adc_prev, 16U, 100U, 0U };
+ */
+typedef struct
+{
+    uint32_t *previous;         // Array with the last logged values (count words)
+    uint32_t count;             // Number of array elements
+    uint32_t keyframe_interval; // Log the complete array every N messages (0 = only the first one)
+    uint32_t frame_counter;     // Messages logged since the last keyframe (0 = next is a keyframe)
+} rte_delta_ctx_t;
+
+/* Space reserved in the circular buffer with RTE_RESERVE() for a message whose DATA
+ * words are written directly to the buffer with rte_reserved_write(). Example:
+ *    rte_reservation_t res;
+ *    RTE_RESERVE(MSGN_SAMPLES, F_ADC, res, 32U);
+ *    if (RTE_RESERVED(res))
+ *    {
+ *        for (uint32_t i = 0U; i < 32U; i++)
+ *        {
+ *            rte_reserved_write(&res, i, adc_dma_buffer[i]);
+ *        }
+ *        rte_commit(&res);
+ *    }
+ */
+typedef struct
+{
+    uint32_t *buffer;   // Circular buffer (NULL if the message has been discarded)
+    uint32_t index;     // Buffer index of the first subpacket
+    uint32_t words;     // Number of DATA words
+    uint32_t fmt_word;  // Format ID and timestamp
+    uint32_t bits31[((uint32_t)(RTE_MAX_SUBPACKETS) + 7U) / 8U];
+                        // Bit 31 of the DATA words - four bits per subpacket
+} rte_reservation_t;
+
 
 /************************************************************************************
  * Functions that "convert" the float or double value to uint32_t
@@ -190,7 +324,17 @@ __STATIC_FORCEINLINE uint32_t double_par(const double number)
  */
 #if !defined(RTE_COMPILE_TIME_PARAMETER_CHECK)
 #define RTE_CHECK_PARAMETERS(filter_no, fmt, and_mask)
+#define RTE_CHECK_PARAMETERS_EXPR(filter_no, fmt, and_mask)  0U
 #else
+/* Version of the check for the initializers (e.g. RTE_BATCH_MSG0() ... RTE_BATCH_MSG4()).
+ * The expression has the value 0. An array with a negative size (compile error) is
+ * declared if the filter number or the format ID is not valid.
+ */
+#define RTE_CHECK_PARAMETERS_EXPR(filter_no, fmt, and_mask)                                      \
+    (0U * (uint32_t)sizeof(char[(((filter_no) < 32U)                                             \
+                                 && ((fmt) < (1U << (uint32_t)(RTE_FMT_ID_BITS)))                \
+                                 && (((fmt) & (and_mask)) == 0U)) ? 1 : -1]))
+
 #define RTE_CHECK_PARAMETERS(filter_no, fmt, and_mask)                                           \
     static_assert((filter_no) < 32U, "The filter value number must be between 0 and 31.");       \
     static_assert((fmt) < (1U << (uint32_t)(RTE_FMT_ID_BITS)), "Format ID value out of range."); \
@@ -321,6 +465,49 @@ __STATIC_FORCEINLINE uint32_t double_par(const double number)
     __rte_string(RTE_PACK(filter_no, fmt, 4U), address);                            \
 }
 
+/* Initializers for the rte_batch_msg_t array used by the RTE_MSG_BATCH() macro.
+ * The parameters are checked at compile time as for the RTE_MSG0() ... RTE_MSG4().
+ * Example:
+ *    rte_batch_msg_t msgs[] = { RTE_BATCH_MSG1(MSG1_STATE, F_STATE, new_state),
+ *                               RTE_BATCH_MSG2(MSG2_EVENT, F_STATE, event, param) };
+ *    RTE_MSG_BATCH(msgs, 2U);
+ */
+#define RTE_BATCH_MSG0(fmt, filter_no)                                              \
+    { RTE_PACK(filter_no, fmt, 0U) + RTE_CHECK_PARAMETERS_EXPR(filter_no, fmt, 0U), \
+      0U, { 0U } }
+
+#define RTE_BATCH_MSG1(fmt, filter_no, data1)                                       \
+    { RTE_PACK(filter_no, fmt, 0U) + RTE_CHECK_PARAMETERS_EXPR(filter_no, fmt, 1U), \
+      1U, { (uint32_t)(data1) } }
+
+#define RTE_BATCH_MSG2(fmt, filter_no, data1, data2)                                \
+    { RTE_PACK(filter_no, fmt, 0U) + RTE_CHECK_PARAMETERS_EXPR(filter_no, fmt, 3U), \
+      2U, { (uint32_t)(data1), (uint32_t)(data2) } }
+
+#define RTE_BATCH_MSG3(fmt, filter_no, data1, data2, data3)                         \
+    { RTE_PACK(filter_no, fmt, 0U) + RTE_CHECK_PARAMETERS_EXPR(filter_no, fmt, 7U), \
+      3U, { (uint32_t)(data1), (uint32_t)(data2), (uint32_t)(data3) } }
+
+#define RTE_BATCH_MSG4(fmt, filter_no, data1, data2, data3, data4)                  \
+    { RTE_PACK(filter_no, fmt, 0U) + RTE_CHECK_PARAMETERS_EXPR(filter_no, fmt, 15U), \
+      4U, { (uint32_t)(data1), (uint32_t)(data2), (uint32_t)(data3), (uint32_t)(data4) } }
+
+#define RTE_MSG_BATCH(msgs, count)   __rte_msg_batch(msgs, count)
+
+#define RTE_DELTA_MSG(fmt, filter_no, ctx, data)                                    \
+{                                                                                   \
+    RTE_CHECK_PARAMETERS(filter_no, fmt, 15U);                                      \
+    __rte_delta_msg(RTE_PACK_MSGX(filter_no, fmt), ctx, data);                      \
+}
+
+#define RTE_RESERVE(fmt, filter_no, res, data_words)                                \
+{                                                                                   \
+    RTE_CHECK_PARAMETERS(filter_no, fmt, 15U);                                      \
+    __rte_reserve(RTE_PACK(filter_no, fmt, 4U), &(res), data_words);                \
+}
+
+#define RTE_RESERVED(res)   ((res).buffer != NULL)
+
 #if defined(_lint) && defined(RTE_USE_ANY_TYPE_UNION)
 #undef RTE_USE_ANY_TYPE_UNION
 #endif
@@ -381,6 +568,11 @@ void __rte_msgn(const uint32_t fmt_id, volatile const void * const address, cons
 void __rte_msgx(const uint32_t fmt_id, volatile const void * const address, const uint32_t data_length);
 void __rte_string(const uint32_t fmt_id, const char * const address);
 void __rte_stringn(const uint32_t fmt_id, const char * const address, const uint32_t max_length);
+void __rte_msg_batch(const rte_batch_msg_t * const msgs, const uint32_t count);
+void __rte_delta_msg(const uint32_t fmt_id, rte_delta_ctx_t * const ctx, const uint32_t * const data);
+void __rte_reserve(const uint32_t fmt_id, rte_reservation_t * const res, const uint32_t data_words);
+void rte_reserved_write(rte_reservation_t * const res, const uint32_t n, const uint32_t value);
+void rte_commit(const rte_reservation_t * const res);
 
 void rte_init(const uint32_t initial_filter_value, const uint32_t init_mode);
 uint32_t rte_get_filter(void);
@@ -399,8 +591,38 @@ void rte_long_timestamp(void);
 #define rte_long_timestamp()
 #endif
 
+#if RTE_SHARED_RTEDBG != 0
+void rte_set_rtedbg(void * const address);
+uint32_t rte_rtedbg_size(void);
+#endif
+
+#if RTE_AUTO_LONG_TIMESTAMP != 0
+void rte_long_timestamp_check(void);
+#else
+#define rte_long_timestamp_check()
+#endif
+
 void rte_timestamp_frequency(const uint32_t new_frequency);
 
+#if RTE_STREAMING_ENABLED != 0
+uint32_t rte_stream_read(uint32_t * const dst, const uint32_t max_words);
+uint32_t rte_stream_get_block(uint32_t ** const address);
+void rte_stream_release(const uint32_t length);
+#endif
+
+#if RTE_STREAM_DMA_ENABLED != 0
+void rte_stream_dma_poll(void);
+void rte_stream_dma_complete(void);
+#endif
+
+#if RTE_DEFERRED_ERASE != 0
+uint32_t rte_erase_step(const uint32_t max_words);
+void rte_erase_done(void);
+#else
+#define rte_erase_step(max_words) 0U
+#define rte_erase_done()
+#endif
+
 #if RTE_FIRMWARE_MAY_SET_FILTER != 0
 void rte_set_filter(uint32_t filter);
 void rte_restore_filter(void);
@@ -409,6 +631,44 @@ void rte_restore_filter(void);
 #define rte_restore_filter()
 #endif
 
+#if RTE_GROUP_DECIMATION != 0
+void rte_set_decimation(uint32_t group, uint32_t divider);
+#else
+#define rte_set_decimation(group, divider)
+#endif
+
+#if RTE_TRIGGER_ENABLED != 0
+void rte_trigger_arm(uint32_t trigger_fmt, uint32_t ext_mask, uint32_t post_words);
+void rte_trigger(void);
+#else
+#define rte_trigger_arm(trigger_fmt, ext_mask, post_words)
+#define rte_trigger()
+#endif
+
+#if ((RTE_CACHE_LINE_SIZE) != 0U) && defined RTE_DCACHE_CLEAN
+void rte_dcache_clean(void);
+#else
+#define rte_dcache_clean()
+#endif
+
+#if RTE_DUAL_BANK != 0
+uint32_t rte_bank_swap(void);
+#else
+#define rte_bank_swap() 0U
+#endif
+
+#if RTE_FLASH_PERSIST != 0
+uint32_t rte_flash_persist(void);
+#else
+#define rte_flash_persist() 0U
+#endif
+
+#if (RTE_FIRMWARE_MAY_SET_FILTER != 0) && ((RTE_CHANNELS) > 1U)
+void rte_set_channel_filter(uint32_t channel, uint32_t filter);
+#else
+#define rte_set_channel_filter(channel, filter)
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -429,12 +689,40 @@ void rte_restore_filter(void);
 #define RTE_MSGX(fmt_id, filter, address, length)
 #define RTE_STRING(fmt_id, filter, address)
 #define RTE_STRINGN(fmt_id, filter, address, length)
+#define RTE_BATCH_MSG0(fmt_id, filter)                              { 0U, 0U, { 0U } }
+#define RTE_BATCH_MSG1(fmt_id, filter, data1)                       { 0U, 0U, { 0U } }
+#define RTE_BATCH_MSG2(fmt_id, filter, data1, data2)                { 0U, 0U, { 0U } }
+#define RTE_BATCH_MSG3(fmt_id, filter, data1, data2, data3)         { 0U, 0U, { 0U } }
+#define RTE_BATCH_MSG4(fmt_id, filter, data1, data2, data3, data4)  { 0U, 0U, { 0U } }
+#define RTE_MSG_BATCH(msgs, count)
+#define RTE_DELTA_MSG(fmt_id, filter, ctx, data)
+#define RTE_RESERVE(fmt_id, filter, res, data_words)  { (res).buffer = (uint32_t *)0; }
+#define RTE_RESERVED(res) 0
+#define rte_reserved_write(res, n, value)
+#define rte_commit(res)
 #define rte_long_timestamp()
+#define rte_long_timestamp_check()
+#define rte_set_rtedbg(address)
+#define rte_rtedbg_size() 0U
 #define rte_timestamp_frequency(new_frequency)
 #define rte_get_filter() 0
 #define rte_restore_filter()
 #define rte_set_filter(filter)
+#define rte_set_channel_filter(channel, filter)
+#define rte_set_decimation(group, divider)
+#define rte_trigger_arm(trigger_fmt, ext_mask, post_words)
+#define rte_trigger()
+#define rte_dcache_clean()
+#define rte_flash_persist() 0U
+#define rte_bank_swap() 0U
 #define RTE_RESTART_TIMING()
+#define rte_stream_read(dst, max_words) 0U
+#define rte_stream_get_block(address) 0U
+#define rte_stream_release(length)
+#define rte_stream_dma_poll()
+#define rte_stream_dma_complete()
+#define rte_erase_step(max_words) 0U
+#define rte_erase_done()
 #endif // RTE_ENABLED != 0
 
 #endif /* RTEDBG_H */
@@ -0,0 +1,196 @@
+/*
+ * Copyright (c) 2024 Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rtedbg.hpp
+ * @author  Branko Premzel
+ * @brief   C++ (C++17 or newer) front end for the RTEdbg data logging functions.
+ *          The format ID, filter number and the number of parameters are template
+ *          parameters. They are checked with static_assert and packed into a
+ *          constant at compile time. The parameters are converted to 32-bit words
+ *          without a change of the bit pattern (float, integer, enum, pointer and
+ *          other trivially copyable types up to 4 bytes).
+ *
+ *          Examples:
+ *              rte::log<MSG2_MOTOR_SPEED, F_MOTOR>(motor_index, speed_rpm);
+ *              rte::log_data<MSGN_ADC_FRAME, F_ADC>(adc_frame);
+ *              rte::log_string<MSGN_STATUS, F_SYSTEM>("Started");
+ *
+ *          Define the macro RTE_CPP_INLINE_LOGGING before including this file
+ *          to use the inline versions of the __rte_msg0() ... __rte_msg4() functions
+ *          from rtedbg_inline.h (see the description there).
+ *
+ * @version RTEdbg library <DEVELOPMENT BRANCH>
+ *******************************************************************************/
+
+#ifndef RTEDBG_HPP
+#define RTEDBG_HPP
+
+#if __cplusplus < 201703L
+#error "The rtedbg.hpp requires C++17 or newer."
+#endif
+
+#if defined RTE_CPP_INLINE_LOGGING
+#include "rtedbg_inline.h"
+#else
+#include "rtedbg.h"
+#endif
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#if __cplusplus > 201703L
+#include <bit>
+#endif
+
+namespace rte
+{
+namespace detail
+{
+
+/* The same packing of the filter number and format ID as the RTE_PACK() macro
+ * (shift = number of low format ID bits used for the top bits of the DATA words).
+ */
+template <uint32_t Filter, uint32_t Fmt, uint32_t Shift>
+constexpr uint32_t pack() noexcept
+{
+    static_assert(Filter < 32U, "The filter value number must be between 0 and 31.");
+    static_assert(Fmt < (1UL << (uint32_t)(RTE_FMT_ID_BITS)), "Format ID value out of range.");
+    static_assert((Fmt & ((1UL << Shift) - 1U)) == 0U,
+                  "Invalid format ID value - lowest bit(s) must be 0.");
+
+    constexpr uint32_t filter = (RTE_MSG_FILTERING_ENABLED != 0) ? (Filter & 0x1FU) : 0U;
+    constexpr uint32_t shift = (RTE_MINIMIZED_CODE_SIZE != 0) ? 0U : Shift;
+    return ((filter << (uint32_t)(RTE_FMT_ID_BITS)) | Fmt) >> shift;
+}
+
+/* Convert a parameter to a 32-bit word without changing its bit pattern. */
+template <typename T>
+inline uint32_t to_word(const T value) noexcept
+{
+    static_assert(sizeof(T) <= sizeof(uint32_t), "The parameter must not be larger than 32 bits.");
+    static_assert(std::is_trivially_copyable<T>::value, "The parameter must be trivially copyable.");
+
+    if constexpr (std::is_enum<T>::value)
+    {
+        return static_cast<uint32_t>(static_cast<typename std::underlying_type<T>::type>(value));
+    }
+    else if constexpr (std::is_integral<T>::value)
+    {
+        return static_cast<uint32_t>(value);    // Sign extended - the same as in the C macros
+    }
+    else if constexpr (std::is_pointer<T>::value)
+    {
+        return static_cast<uint32_t>(reinterpret_cast<uintptr_t>(value));
+    }
+#if defined __cpp_lib_bit_cast
+    else if constexpr (sizeof(T) == sizeof(uint32_t))
+    {
+        return std::bit_cast<uint32_t>(value);
+    }
+#endif
+    else
+    {
+        uint32_t word = 0U;
+        std::memcpy(&word, &value, sizeof(T));
+        return word;
+    }
+}
+
+} // namespace detail
+
+#if RTE_ENABLED != 0
+
+/********************************************************************************
+ * @brief Log a message with zero to four parameters (__rte_msg0() ... __rte_msg4()).
+ *
+ * @tparam Fmt     Format ID (the lowest N bits must be zero for N parameters)
+ * @tparam Filter  Filter number (0 ... 31)
+ * @param  args    Zero to four parameters (max. 32 bits each)
+ ********************************************************************************/
+
+template <uint32_t Fmt, uint32_t Filter, typename... Args>
+inline void log(const Args... args) noexcept
+{
+    constexpr uint32_t count = sizeof...(Args);
+    static_assert(count <= 4U, "Use rte::log_data() for messages with more than four words.");
+    constexpr uint32_t fmt_id = detail::pack<Filter, Fmt, count>();
+
+    if constexpr (count == 0U)
+    {
+        __rte_msg0(fmt_id);
+    }
+    else if constexpr (count == 1U)
+    {
+        __rte_msg1(fmt_id, detail::to_word(args)...);
+    }
+    else if constexpr (count == 2U)
+    {
+        __rte_msg2(fmt_id, detail::to_word(args)...);
+    }
+    else if constexpr (count == 3U)
+    {
+        __rte_msg3(fmt_id, detail::to_word(args)...);
+    }
+    else
+    {
+        __rte_msg4(fmt_id, detail::to_word(args)...);
+    }
+}
+
+/********************************************************************************
+ * @brief Log the contents of a variable, structure or array with __rte_msgn().
+ *
+ * @tparam Fmt     Format ID (the lowest 4 bits must be zero)
+ * @tparam Filter  Filter number (0 ... 31)
+ * @param  data    Data to be logged (max. RTE_MAX_MSG_SIZE bytes)
+ ********************************************************************************/
+
+template <uint32_t Fmt, uint32_t Filter, typename T>
+inline void log_data(const T &data) noexcept
+{
+    static_assert(sizeof(T) <= RTE_MAX_MSG_SIZE, "The data is larger than RTE_MAX_MSG_SIZE.");
+    __rte_msgn(detail::pack<Filter, Fmt, 4U>(), &data, (uint32_t)sizeof(T));
+}
+
+/********************************************************************************
+ * @brief Log a string with __rte_string().
+ *
+ * @tparam Fmt     Format ID (the lowest 4 bits must be zero)
+ * @tparam Filter  Filter number (0 ... 31)
+ * @param  text    Null terminated string
+ ********************************************************************************/
+
+template <uint32_t Fmt, uint32_t Filter>
+inline void log_string(const char * const text) noexcept
+{
+    __rte_string(detail::pack<Filter, Fmt, 4U>(), text);
+}
+
+#else // RTE_ENABLED != 0
+
+template <uint32_t Fmt, uint32_t Filter, typename... Args>
+inline void log(const Args...) noexcept
+{
+}
+
+template <uint32_t Fmt, uint32_t Filter, typename T>
+inline void log_data(const T &) noexcept
+{
+}
+
+template <uint32_t Fmt, uint32_t Filter>
+inline void log_string(const char * const) noexcept
+{
+}
+
+#endif // RTE_ENABLED != 0
+
+} // namespace rte
+
+#endif // RTEDBG_HPP
+
+/*==== End of file ====*/
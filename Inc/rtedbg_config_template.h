@@ -50,6 +50,9 @@ extern "C" {
 
 /* CPU core-specific functions for buffer space reservation. */
 #define RTE_CPU_DRIVER  "## Insert the CPU driver file path here ##" // e.g. "rtedbg_cortex_m_mutex.h"
+  /* The "rtedbg_cortex_m_itm.h" driver also sends each message to an ITM stimulus
+   * port (SWO output) - define RTE_ITM_PORT (default 0) to select the port.
+   */
 
 
 /*****************************************
@@ -129,6 +132,18 @@ extern "C" {
    * 0 - Long timestamp not used (only relative times between messages are logged).
    */
 
+#define RTE_AUTO_LONG_TIMESTAMP           0
+  /* 1 - The long timestamp is logged automatically when the timestamp bits in the FMT
+   *     words wrap around. The wrap is detected by the logging functions - a compare
+   *     is added to each of them. Periodic rte_long_timestamp() calls are not needed.
+   *     The detection uses no locking - nested callers may log the long timestamp
+   *     message twice (harmless for the decoding). It requires at least one logged
+   *     message (or rte_long_timestamp_check() call, e.g. from the timer overflow
+   *     interrupt) in each half of the timestamp period. Requires RTE_USE_LONG_TIMESTAMP.
+   * 0 - The long timestamp is logged only by the rte_long_timestamp() calls (default
+   *     value if the macro is not defined).
+   */
+
 #define RTE_SINGLE_SHOT_ENABLED           0
   /* 1 - Both post-mortem and single shot logging available to the programmer.
    *     Which logging method will be used is defined by the rte_init() function parameter.
@@ -146,6 +161,225 @@ extern "C" {
    * 0 - Shorten messages that are too long to the maximum size.
    */
 
+//#define RTE_MSGX_WORD_ACCESS            1
+  /* 1 - __rte_msgx() copies word-aligned data as 32-bit words and only the bytes after
+   *     the last complete word one by one (little-endian CPU cores only).
+   * 0 - Data is always copied byte by byte.
+   * The default value is set according to the compiler's endianness macros
+   * (__BYTE_ORDER__ or __LITTLE_ENDIAN__). Define it if the compiler does not provide them.
+   */
+
+#define RTE_STREAMING_ENABLED             0
+  /* 1 - Streaming mode enabled. A low priority task can continuously transfer the logged
+   *     data to the host (e.g. over UART, USB or RTT) with the rte_stream_read() function
+   *     while the data logging continues. Messages that would overwrite data not yet
+   *     read are discarded and counted in g_rtedbg.overrun_count. The RTE_BUFFER_SIZE
+   *     must be a power of 2 and single shot logging must be disabled.
+   * 0 - Streaming mode disabled (default value if the macro is not defined).
+   */
+
+#define RTE_STREAM_DMA_ENABLED            0
+  /* 1 - The rte_stream_dma_poll() and rte_stream_dma_complete() functions transfer blocks
+   *     of logged data directly from the circular buffer with a DMA channel (no copying).
+   *     A block ends with the first subpacket that reaches the middle or the end of the
+   *     circular buffer - it may extend up to four words past the middle (or into the
+   *     four word trailer at the end of the buffer).
+   *     Streaming mode must be enabled. Call rte_stream_dma_poll() periodically and
+   *     rte_stream_dma_complete() from the DMA transfer complete interrupt. Define the
+   *     following macros:
+   *        #define RTE_STREAM_DMA_START(address, length)  // Start the transfer of 'length' words
+   *        #define RTE_STREAM_HALF_CALLBACK()  // Optional - first half of the buffer transferred
+   *        #define RTE_STREAM_FULL_CALLBACK()  // Optional - second half of the buffer transferred
+   *     Clean the data cache for the transferred block in RTE_STREAM_DMA_START() if the
+   *     circular buffer is in a cacheable memory region.
+   * 0 - DMA transfer functions disabled (default value if the macro is not defined).
+   */
+
+#define RTE_DEFERRED_ERASE                0
+  /* 1 - rte_init() does not erase the circular buffer, so its execution time does not
+   *     depend on the buffer size. Message logging stays disabled until the buffer
+   *     has been erased by repeated calls of rte_erase_step(max_words) - e.g. from
+   *     the idle task - or by the firmware (e.g. with a DMA transfer that sets all
+   *     words of g_rtedbg.buffer to 0xFFFFFFFF) followed by a call of rte_erase_done().
+   *     Messages logged before the erase is complete are discarded.
+   * 0 - The buffer is erased in rte_init() (default value if the macro is not defined).
+   */
+
+#define RTE_WRITE_POSITION                0
+  /* 1 - The buf_index is a free running write position. It is not limited to the
+   *     buffer size but increases with every word written to the circular buffer.
+   *     The header contains an additional index_mask word (RTE_BUFFER_SIZE - 1).
+   *     The host software can compute the number of buffer wraps and read only the
+   *     data logged since the last snapshot (it has fallen behind if the position
+   *     has increased by more than RTE_BUFFER_SIZE). Only for buffer sizes that
+   *     are a power of 2. Cannot be used in streaming mode.
+   * 0 - The buf_index is limited to the buffer size (default value if the macro
+   *     is not defined).
+   */
+
+#define RTE_CACHE_LINE_SIZE               0
+  /* Data cache line size in bytes (16, 32, 64 or 128) - e.g. 32 for the Cortex-M7.
+   *     The g_rtedbg structure(s) and the circular buffer are aligned to cache line
+   *     boundaries. Padding words are added to the end of the header (included in the
+   *     header size in rte_cfg) and after the buffer, so the header never shares a
+   *     cache line with the buffer data or with the structure of another CPU core.
+   *     The order of the header words is not changed - it is defined by the data
+   *     format of the host software. The alignment is defined with RTE_CACHE_ALIGNED -
+   *     see the compiler-specific definitions below.
+   *     If the following macro is defined, the rte_dcache_clean() function cleans only
+   *     the header and the part of the buffer written since its previous call - e.g.
+   *     before a snapshot is read by a debug probe or DMA that bypasses the cache:
+   *        #define RTE_DCACHE_CLEAN(address, size)  \
+   *            SCB_CleanDCache_by_Addr((void *)(address), (int32_t)(size))
+   *     The macro must clean all cache lines that contain part of the memory block.
+   * 0 - The layout is not aligned to the cache lines (default value if the macro is
+   *     not defined).
+   */
+
+#define RTE_FLASH_PERSIST                 0
+  /* 1 - The rte_flash_persist() function stops the message logging (filter = 0) and
+   *     writes the g_rtedbg structure(s) to a reserved flash area - e.g. from the
+   *     HardFault handler or the watchdog early warning interrupt. The image has the
+   *     same format as g_rtedbg and can be read after the reset and decoded with
+   *     RTEmsg even if no debug probe was connected when the fault occurred. The
+   *     header and the newest data are written first. Blocks containing only erased
+   *     words are skipped. The flash area must already be erased (erase it after the
+   *     image has been saved). The following must be defined:
+   *        #define RTE_FLASH_ADDRESS     0x080E0000U  // Address of the erased flash area
+   *        #define RTE_FLASH_BLOCK_SIZE  32U          // Flash programming unit [bytes]
+   *        #define RTE_FLASH_PROGRAM(flash_address, data, size)  \
+   *            flash_program_block((flash_address), (data), (size))
+   *     The RTE_FLASH_PROGRAM() must program 'size' bytes from the word-aligned 'data'
+   *     to the block-aligned 'flash_address' and must not return until they have been
+   *     programmed (a DMA transfer can be used). Use the largest programming unit of
+   *     the flash (e.g. a flash word, row or page) to minimize the write time. The
+   *     area size is sizeof(rtedbg_t) rounded up to RTE_FLASH_BLOCK_SIZE for each
+   *     CPU core or logging channel.
+   * 0 - Flash persistence disabled (default value if the macro is not defined).
+   */
+
+#define RTE_SHARED_RTEDBG                 0
+  /* 1 - The g_rtedbg structure is accessed through the g_rte_shared_rtedbg pointer.
+   *     The rte_set_rtedbg(address) function places the data logging structure in
+   *     another memory block of rte_rtedbg_size() bytes - e.g. in a Linux shared
+   *     memory object mapped into several processes (see the rtedbg_linux_shm.h).
+   *     All processes then log to the same circular buffer and an external process
+   *     can read the data directly. Call it before rte_init(). Cannot be used with
+   *     RTE_SMP_CORES > 1 or RTE_CHANNELS > 1. Adds one pointer load to the logging
+   *     functions.
+   * 0 - The data logging structure is the g_rtedbg (default value if the macro is
+   *     not defined).
+   */
+
+#define RTE_DUAL_BANK                     0
+  /* 1 - Two data logging structures (banks) - g_rtedbg and g_rtedbg_bank1. Messages
+   *     are logged to the active bank. The rte_bank_swap() erases the inactive bank
+   *     and makes it the active one, so the host can read a consistent snapshot of
+   *     the previously active bank at its own pace while the logging continues
+   *     without a gap. Messages being logged during the swap are completed in the
+   *     old bank. The g_rte_bank_table descriptor contains the number of the active
+   *     bank, the bank addresses and the swap_count. The host sets the read_count to
+   *     the swap_count after reading a bank - the bank is not reused before that.
+   *     Place the second bank with RTE_DBG_RAM_BANK1 (default RTE_DBG_RAM). Cannot
+   *     be used with RTE_SMP_CORES > 1, RTE_CHANNELS > 1, RTE_SHARED_RTEDBG, streaming,
+   *     deferred erase or trigger mode. Adds one pointer load to the logging functions.
+   * 0 - Single data logging structure (default value if the macro is not defined).
+   */
+
+#define RTE_TRIGGER_ENABLED               0
+  /* 1 - Trigger mode enabled. After rte_trigger_arm(trigger_fmt, ext_mask, post_words),
+   *     the data is logged circularly until rte_trigger() is called or a message with
+   *     the trigger format ID (any extended data value within ext_mask) is logged. After another post_words words have been
+   *     logged, the message logging is stopped (filter = 0), so the buffer contains
+   *     the data logged before and after the event. The g_rte_trigger structure
+   *     contains the state and the buffer index of the trigger. Requires message
+   *     filtering. Adds one compare to the logging functions.
+   * 0 - Trigger mode disabled (default value if the macro is not defined).
+   */
+
+#define RTE_GROUP_DECIMATION              0
+  /* 1 - Optional decimation of the message groups. Only one of every N messages of
+   *     a group (filter number) that passed the filter is logged. The divider N of
+   *     each group is set in the g_rte_decimation.divider[] array with
+   *     rte_set_decimation(group, N) or written by the debug probe while the firmware
+   *     is running. High-rate groups can thus stay enabled without filling the buffer.
+   *     Divider values 0 and 1 log all messages of the group (default after reset).
+   *     Requires message filtering. Slightly slows down the logging.
+   * 0 - Decimation disabled (default value if the macro is not defined).
+   */
+
+#define RTE_GROUP_WORD_STATS              0
+  /* 1 - Count the circular buffer words logged by each message group (filter number)
+   *     in the g_rte_group_words[32] array. The counters are free running - the host
+   *     can read the array periodically with a debug probe and display the number of
+   *     words per second for each group. Use it to find the groups that should be
+   *     disabled or decimated so that the post-mortem buffer covers a long enough
+   *     time. Requires message filtering. Adds one addition to the logging functions.
+   * 0 - Statistics disabled (default value if the macro is not defined).
+   */
+
+#define RTE_RESERVATION_STATS             0
+  /* 1 - Count the buffer space reservations, repeated reservation attempts and the
+   *     largest number of repeated attempts for a single message in the
+   *     g_rte_reservation_stats structure (one per CPU core if RTE_SMP_CORES > 1).
+   *     Repeated attempts are caused by tasks or interrupts that log messages while
+   *     another one is reserving space (only with drivers using exclusive access or
+   *     compare-and-swap instructions). Use it to check whether the interrupt
+   *     priorities cause jitter in the data logging, or whether a simpler driver
+   *     such as rtedbg_generic_non_reentrant.h could be used. Slows down the logging.
+   * 0 - Statistics disabled (default value if the macro is not defined).
+   */
+
+#define RTE_LOSS_STATS                    0
+  /* 1 - Count the messages that were not logged completely in the g_rtedbg header:
+   *     too_long_count    - messages longer than the maximum size (discarded or
+   *                         truncated - see RTE_DISCARD_TOO_LONG_MESSAGES),
+   *     buffer_full_count - single-shot mode: messages discarded because the
+   *                         circular buffer was full.
+   *     Messages discarded in streaming mode are counted in the overrun_count.
+   *     The counters are reset by rte_init() together with the buffer. The host
+   *     can check whether a snapshot is complete and measure the data to set the
+   *     RTE_BUFFER_SIZE and RTE_MAX_SUBPACKETS. The header contains two additional
+   *     words. Adds only code on the paths where the messages are discarded.
+   * 0 - Statistics disabled (default value if the macro is not defined).
+   */
+
+#define RTE_SMP_CORES                     1
+  /* Number of CPU cores with their own data logging structure (max. 8).
+   * 1 - All messages are logged to a single g_rtedbg structure (default value if
+   *     the macro is not defined).
+   * N - g_rtedbg is an array of N data logging structures - one for each CPU core.
+   *     Each core logs only to its own circular buffer, so no cross-core atomic
+   *     operations are needed. Use a single-core CPU driver (e.g. the
+   *     rtedbg_cortex_m_mutex.h or rtedbg_generic_atomic.h) and define the macro
+   *     RTE_GET_CORE_ID() that returns the number of the core executing the code
+   *     (0 ... N-1). Example:
+   *        #define RTE_GET_CORE_ID()  HAL_GetCurrentCPUID()
+   *     All cores must use the same timestamp counter, so that the host software
+   *     can merge the messages from all buffers by timestamp.
+   */
+
+#define RTE_CHANNELS                      1
+  /* Number of independent logging channels (max. 4).
+   * 1 - All messages are logged to the g_rtedbg structure (default value if the
+   *     macro is not defined).
+   * N - Messages are routed to the channels by the filter number (message group).
+   *     Channel #0 is g_rtedbg, channels #1 ... #3 are g_rtedbg_ch1 ... g_rtedbg_ch3.
+   *     Each channel has its own circular buffer (all of RTE_BUFFER_SIZE words) and
+   *     filter, so e.g. frequent diagnostic messages cannot overwrite the rare but
+   *     important ones of another channel. The groups of a channel are defined with
+   *     masks that have the same bit layout as the filter (bit 31 = filter #0):
+   *        #define RTE_CHANNEL1_FILTERS  ((1UL << (31U - F_MOTOR)) | (1UL << (31U - F_ADC)))
+   *     Message groups that are not in any of the RTE_CHANNEL1_FILTERS ...
+   *     RTE_CHANNEL3_FILTERS masks are logged to channel #0. The memory section of a
+   *     channel can be defined with the RTE_DBG_RAM_CH1 ... RTE_DBG_RAM_CH3 macros
+   *     (RTE_DBG_RAM is used if they are not defined). The host software finds the
+   *     channels with the g_rte_channel_table descriptor table. Use
+   *     rte_set_channel_filter() to change the filter of a single channel.
+   *     Requires message filtering and cannot be used with RTE_SMP_CORES > 1 or
+   *     streaming mode.
+   */
+
 
 /*********************************************************************************
  *              COMPILER-SPECIFIC DEFINITIONS
@@ -163,6 +397,13 @@ extern "C" {
  *-----------------------------------------------------------------------------*/
 #define RTE_DBG_RAM  __attribute__((section("RTEDBG"))) __attribute__((used))
 
+/*-----------------------------------------------------------------------------
+ * Alignment of the g_rtedbg data structures to the data cache line boundaries -
+ * used only if RTE_CACHE_LINE_SIZE != 0. The definition below is the default
+ * value if the macro is not defined. Modify it if it does not fit your compiler.
+ *-----------------------------------------------------------------------------*/
+#define RTE_CACHE_ALIGNED  __attribute__((aligned(RTE_CACHE_LINE_SIZE)))
+
 /*---------------------------------------------------------------------------
  * Code optimization parameters for the functions in the rtedbg.c file.
  *
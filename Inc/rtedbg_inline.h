@@ -37,50 +37,64 @@
 #include RTE_USE_LOCAL_CPU_DRIVER   // A different CPU driver may be defined for the given files.
 #endif
 
+// Output of a completely written message - defined by a CPU driver (e.g. rtedbg_cortex_m_itm.h)
+#if !defined RTE_MSG_OUTPUT
+#define RTE_MSG_OUTPUT(buffer, index, size)  {(void)(index); (void)(size);}
+#endif
+
 
 __STATIC_FORCEINLINE void __rte_msg0(const uint32_t fmt_id)
 {
-    rtedbg_t *p_rtedbg = &g_rtedbg;
+    rtedbg_t *p_rtedbg = RTE_MSG_RTEDBG(fmt_id, 0U);
 
 #if RTE_DELAYED_TSTAMP_READ != 1
     uint32_t timestamp = (rte_get_timestamp() >> ((RTE_TIMESTAMP_SHIFT) - 1U)) & RTE_TIMESTAMP_MASK;
+    RTE_LONG_TIMESTAMP_CHECK(timestamp)
 #endif
 
-    if (RTE_MESSAGE_DISABLED(p_rtedbg->filter, fmt_id, 0U))
+    if (RTE_MESSAGE_SKIPPED(p_rtedbg->filter, fmt_id, 0U))
     {
         return;     // Discard the message if not enabled
     }
 
+    RTE_LONG_TIMESTAMP_PRECHECK()
     uint32_t buf_index;
     RTE_RESERVE_SPACE(p_rtedbg, buf_index, 1U);                             //lint !e717
+    RTE_TRIGGER_CHECK(fmt_id, 0U, buf_index, 1U)
+    RTE_COUNT_GROUP_WORDS(fmt_id, 0U, 1U)
 
 #if RTE_DELAYED_TSTAMP_READ != 0
     uint32_t timestamp = (rte_get_timestamp() >> ((RTE_TIMESTAMP_SHIFT) - 1U)) & RTE_TIMESTAMP_MASK;
 #endif
 
     p_rtedbg->buffer[buf_index] = timestamp | 1U | (fmt_id << (32U - (uint32_t)(RTE_FMT_ID_BITS)));
+    RTE_MSG_OUTPUT(p_rtedbg->buffer, buf_index, 1U)
 }
 
 
 __STATIC_FORCEINLINE void __rte_msg1(const uint32_t fmt_id, const rte_any32_t data1)
 {
-    rtedbg_t *p_rtedbg = &g_rtedbg;
+    rtedbg_t *p_rtedbg = RTE_MSG_RTEDBG(fmt_id, 1U);
 
 #if RTE_DELAYED_TSTAMP_READ != 1
     uint32_t timestamp = (rte_get_timestamp() >> ((RTE_TIMESTAMP_SHIFT) - 1U)) & RTE_TIMESTAMP_MASK;
+    RTE_LONG_TIMESTAMP_CHECK(timestamp)
 #endif
 
-    if (RTE_MESSAGE_DISABLED(p_rtedbg->filter, fmt_id, 1U))
+    if (RTE_MESSAGE_SKIPPED(p_rtedbg->filter, fmt_id, 1U))
     {
         return;
     }
 
+    RTE_LONG_TIMESTAMP_PRECHECK()
     uint32_t buf_index;
     RTE_RESERVE_SPACE(p_rtedbg, buf_index, 2U);                             //lint !e717
+    RTE_TRIGGER_CHECK(fmt_id, 1U, buf_index, 2U)
+    RTE_COUNT_GROUP_WORDS(fmt_id, 1U, 2U)
 
     rte_pack_data_t data;                                                   //lint !e9018
     data.w32.bits31 = fmt_id;
-    uint32_t *data_packet = &g_rtedbg.buffer[buf_index];
+    uint32_t *data_packet = &p_rtedbg->buffer[buf_index];
 
     data.w32.data = RTE_PARAM(data1);
     data.w64 <<= 1U;
@@ -91,31 +105,36 @@ __STATIC_FORCEINLINE void __rte_msg1(const uint32_t fmt_id, const rte_any32_t da
     uint32_t timestamp = (rte_get_timestamp() >> ((RTE_TIMESTAMP_SHIFT) - 1U)) & RTE_TIMESTAMP_MASK;
 #endif
     *data_packet = timestamp | 1U | (data.w32.bits31 << (32U - (uint32_t)(RTE_FMT_ID_BITS)));
+    RTE_MSG_OUTPUT(p_rtedbg->buffer, buf_index, 2U)
 }
 
 
 __STATIC_FORCEINLINE void __rte_msg2(const uint32_t fmt_id, const rte_any32_t data1, const rte_any32_t data2)
 {
-    rtedbg_t *p_rtedbg = &g_rtedbg;
+    rtedbg_t *p_rtedbg = RTE_MSG_RTEDBG(fmt_id, 2U);
 
 #if RTE_DELAYED_TSTAMP_READ != 1
     uint32_t timestamp = (rte_get_timestamp() >> ((RTE_TIMESTAMP_SHIFT) - 1U)) & RTE_TIMESTAMP_MASK;
+    RTE_LONG_TIMESTAMP_CHECK(timestamp)
 #endif
 
-    if (RTE_MESSAGE_DISABLED(p_rtedbg->filter, fmt_id, 2U))
+    if (RTE_MESSAGE_SKIPPED(p_rtedbg->filter, fmt_id, 2U))
     {
         return;
     }
 
+    RTE_LONG_TIMESTAMP_PRECHECK()
     uint32_t buf_index;
     RTE_RESERVE_SPACE(p_rtedbg, buf_index, 3U);                             //lint !e717
+    RTE_TRIGGER_CHECK(fmt_id, 2U, buf_index, 3U)
+    RTE_COUNT_GROUP_WORDS(fmt_id, 2U, 3U)
 
     rte_pack_data_t data;                                                   //lint !e9018
     data.w32.bits31 = fmt_id;
 
     data.w32.data = RTE_PARAM(data1);
     data.w64 <<= 1U;
-    uint32_t *data_packet = &g_rtedbg.buffer[buf_index];
+    uint32_t *data_packet = &p_rtedbg->buffer[buf_index];
     *data_packet = data.w32.data;
     data_packet++;
 
@@ -129,32 +148,37 @@ __STATIC_FORCEINLINE void __rte_msg2(const uint32_t fmt_id, const rte_any32_t da
 #endif
     // The FMT word with timestamp is written as the last value after other values are already in the buffer
     *data_packet = timestamp | 1U | (data.w32.bits31 << (32U - (uint32_t)(RTE_FMT_ID_BITS)));
+    RTE_MSG_OUTPUT(p_rtedbg->buffer, buf_index, 3U)
 }
 
 
 __STATIC_FORCEINLINE void __rte_msg3(const uint32_t fmt_id, const rte_any32_t data1,
                                 const rte_any32_t data2, const rte_any32_t data3)
 {
-    rtedbg_t *p_rtedbg = &g_rtedbg;
+    rtedbg_t *p_rtedbg = RTE_MSG_RTEDBG(fmt_id, 3U);
 
 #if RTE_DELAYED_TSTAMP_READ != 1
     uint32_t timestamp = (rte_get_timestamp() >> ((RTE_TIMESTAMP_SHIFT) - 1U)) & RTE_TIMESTAMP_MASK;
+    RTE_LONG_TIMESTAMP_CHECK(timestamp)
 #endif
 
-    if (RTE_MESSAGE_DISABLED(p_rtedbg->filter, fmt_id, 3U))
+    if (RTE_MESSAGE_SKIPPED(p_rtedbg->filter, fmt_id, 3U))
     {
         return;
     }
 
+    RTE_LONG_TIMESTAMP_PRECHECK()
     uint32_t buf_index;
     RTE_RESERVE_SPACE(p_rtedbg, buf_index, 4U);                             //lint !e717
+    RTE_TRIGGER_CHECK(fmt_id, 3U, buf_index, 4U)
+    RTE_COUNT_GROUP_WORDS(fmt_id, 3U, 4U)
 
     rte_pack_data_t data;                                                   //lint !e9018
     data.w32.bits31 = fmt_id;
 
     data.w32.data = RTE_PARAM(data1);
     data.w64 <<= 1U;    // The top bit of all data words are packed to the FMT word
-    uint32_t *data_packet = &g_rtedbg.buffer[buf_index];
+    uint32_t *data_packet = &p_rtedbg->buffer[buf_index];
     *data_packet = data.w32.data;
     data_packet++;
 
@@ -174,25 +198,30 @@ __STATIC_FORCEINLINE void __rte_msg3(const uint32_t fmt_id, const rte_any32_t da
 
     // The FMT word with timestamp is written as the last value after other values are already in the buffer
     *data_packet = timestamp | 1U | (data.w32.bits31 << (32U - (uint32_t)(RTE_FMT_ID_BITS)));
+    RTE_MSG_OUTPUT(p_rtedbg->buffer, buf_index, 4U)
 }
 
 
 __STATIC_FORCEINLINE void __rte_msg4(const uint32_t fmt_id, const rte_any32_t data1, const rte_any32_t data2,
                                 const rte_any32_t data3, const rte_any32_t data4)
 {
-    rtedbg_t *p_rtedbg = &g_rtedbg;
+    rtedbg_t *p_rtedbg = RTE_MSG_RTEDBG(fmt_id, 4U);
 
 #if RTE_DELAYED_TSTAMP_READ != 1
     uint32_t timestamp = (rte_get_timestamp() >> ((RTE_TIMESTAMP_SHIFT) - 1U)) & RTE_TIMESTAMP_MASK;
+    RTE_LONG_TIMESTAMP_CHECK(timestamp)
 #endif
 
-    if (RTE_MESSAGE_DISABLED(p_rtedbg->filter, fmt_id, 4U))
+    if (RTE_MESSAGE_SKIPPED(p_rtedbg->filter, fmt_id, 4U))
     {
         return;
     }
 
+    RTE_LONG_TIMESTAMP_PRECHECK()
     uint32_t buf_index;
     RTE_RESERVE_SPACE(p_rtedbg, buf_index, 5U);                             //lint !e717
+    RTE_TRIGGER_CHECK(fmt_id, 4U, buf_index, 5U)
+    RTE_COUNT_GROUP_WORDS(fmt_id, 4U, 5U)
 
     rte_pack_data_t data;                                                   //lint !e9018
     data.w32.bits31 = fmt_id;
@@ -200,7 +229,7 @@ __STATIC_FORCEINLINE void __rte_msg4(const uint32_t fmt_id, const rte_any32_t da
     // Save data to the buffer
     data.w32.data = RTE_PARAM(data1);
     data.w64 <<= 1U;
-    uint32_t *data_packet = &g_rtedbg.buffer[buf_index];
+    uint32_t *data_packet = &p_rtedbg->buffer[buf_index];
     *data_packet = data.w32.data;
     data_packet++;
 
@@ -225,6 +254,7 @@ __STATIC_FORCEINLINE void __rte_msg4(const uint32_t fmt_id, const rte_any32_t da
 
     // The FMT word with timestamp is written as the last value after other values are already in the buffer
     *data_packet = timestamp | 1U | (data.w32.bits31 << (32U - (uint32_t)(RTE_FMT_ID_BITS)));
+    RTE_MSG_OUTPUT(p_rtedbg->buffer, buf_index, 5U)
 }
 
 #endif /* RTEDBG_INLINE_H */
@@ -17,6 +17,11 @@
 #define RTEDBG_INT_H
 
 #include "rtedbg.h"
+#include <stddef.h>
+
+// Strings with up to RTE_STRING_WINDOW_SIZE bytes are copied by __rte_stringn() to
+// a window on the stack while the null byte is searched for - they are read only once.
+#define RTE_STRING_WINDOW_SIZE  64U
 
 // Test if the value is a power of 2 and between 2^2 and 2^31
 // Result is FALSE if the value is not in the range or not a power of 2
@@ -41,7 +46,19 @@
 
 #define RTE_TIMESTAMP_MASK  (0xFFFFFFFFU >> (uint32_t)(RTE_FMT_ID_BITS))
 
-#define RTE_HEADER_SIZE  (sizeof(g_rtedbg) - sizeof(g_rtedbg.buffer))
+/* Value of buf_index after the space for a message has been reserved. The index is
+ * either limited to the buffer size or runs freely (see RTE_WRITE_POSITION).
+ * raw_index - buf_index value before the reservation
+ * index     - index of the first message word (raw_index limited to the buffer size)
+ */
+#if RTE_WRITE_POSITION != 0
+#define RTE_NEXT_INDEX(raw_index, index, size)  ((raw_index) + (size))
+#else
+#define RTE_NEXT_INDEX(raw_index, index, size)  ((index) + (size))
+#endif
+
+#define RTE_HEADER_SIZE  \
+    (sizeof(rtedbg_t) - ((((uint32_t)(RTE_BUFFER_SIZE)) + 4U + (RTE_BUF_PAD_WORDS)) * sizeof(uint32_t)))
 
 /***********************************************************************************
  * The configuration word defines the embedded system RTEdbg configuration.
@@ -51,10 +68,10 @@
  *        2: 1 = RTE_FILTER_OFF_ENABLED, 0 - filter off not possible
  *        3: 1 = RTE_SINGLE_SHOT_ENABLED, 0 - only post mortem mode possible
  *        4: 1 = RTE_USE_LONG_TIMESTAMP, 0 - long timestamps disabled
- *  5 ..  7: reserved for future use
+ *  5 ..  7: RTE_SMP_CORES - 1 (number of per-core g_rtedbg structures: 0 = 1 ... 7 = 8)
  *  8 .. 11: RTE_TIMESTAMP_SHIFT (0 = shift by 1, 1 = shift by 2, etc.)
  * 12 .. 14: RTE_FMT_ID_BITS     (offset 9 => values 0 .. 7 = 9 .. 16)
- *       15: reserved for future use
+ *       15: 1 = RTE_STREAMING_ENABLED (header contains rd_index and overrun_count)
  * 16 .. 23: RTE_MAX_SUBPACKETS  (1 .. 256 - value 0 = 256)
  * 24 .. 30: RTE_HDR_SIZE (header size - number of 32b words)
  *       31: RTE_BUFF_SIZE_RTE_IS_POWER_OF_2 (1 = buffer size is power of 2, 0 - is not)
@@ -74,10 +91,12 @@
         ((uint32_t)RTE_FILTER_OFF_ENABLED                    * (1U <<  2U)) + \
         ((uint32_t)RTE_SINGLE_SHOT_ENABLED                   * (1U <<  3U)) + \
         ((uint32_t)RTE_USE_LONG_TIMESTAMP                    * (1U <<  4U)) + \
+        ((((uint32_t)RTE_SMP_CORES) - 1U)                    * (1U <<  5U)) + \
         ((((uint32_t)RTE_TIMESTAMP_SHIFT) - 1U)              * (1U <<  8U)) + \
         ((((uint32_t)RTE_FMT_ID_BITS) - 9U)                  * (1U << 12U)) + \
+        ((uint32_t)RTE_STREAMING_ENABLED                     * (1U << 15U)) + \
         ((((uint32_t)RTE_MAX_SUBPACKETS) & 0xFFU)            * (1U << 16U)) + \
-        (((sizeof(g_rtedbg) - sizeof(g_rtedbg.buffer)) / 4U) * (1U << 24U)) + \
+        ((RTE_HEADER_SIZE / 4U)                              * (1U << 24U)) + \
         (RTE_BUFF_SIZE_IS_POWER_OF_2                         * (1U << 31U))   \
     )
 
@@ -110,6 +129,215 @@
 #error "The RTE_USE_LONG_TIMESTAMP must have a value of 0 or 1"
 #endif
 
+#if (RTE_STREAMING_ENABLED > 1) || (RTE_STREAMING_ENABLED < 0)
+#error "The RTE_STREAMING_ENABLED must have a value of 0 or 1"
+#endif
+
+#if (RTE_STREAMING_ENABLED != 0) && (RTE_SINGLE_SHOT_ENABLED != 0)
+#error "Streaming mode cannot be combined with single shot logging."
+#endif
+
+#if (RTE_STREAMING_ENABLED != 0) && (RTE_BUFF_SIZE_IS_POWER_OF_2 == 0)
+#error "The RTE_BUFFER_SIZE must be a power of 2 if streaming mode is enabled."
+#endif
+
+#if (RTE_STREAM_DMA_ENABLED != 0) && (RTE_STREAMING_ENABLED == 0)
+#error "The streaming mode must be enabled for DMA transfers of the circular buffer."
+#endif
+
+#if (RTE_STREAM_DMA_ENABLED != 0) && !defined RTE_STREAM_DMA_START
+#error "The RTE_STREAM_DMA_START(address, length) macro must be defined for DMA transfers."
+#endif
+
+#if !defined RTE_STREAM_HALF_CALLBACK
+#define RTE_STREAM_HALF_CALLBACK()
+#endif
+
+#if !defined RTE_STREAM_FULL_CALLBACK
+#define RTE_STREAM_FULL_CALLBACK()
+#endif
+
+#if ((RTE_SMP_CORES) > 8U) || ((RTE_SMP_CORES) < 1U)
+#error "The RTE_SMP_CORES must have a value between min. 1 and max. 8"
+#endif
+
+#if ((RTE_SMP_CORES) > 1U) && !defined RTE_GET_CORE_ID
+#error "The RTE_GET_CORE_ID() macro must be defined if RTE_SMP_CORES > 1"
+#endif
+
+#if (RTE_RESERVATION_STATS > 1) || (RTE_RESERVATION_STATS < 0)
+#error "The RTE_RESERVATION_STATS must have a value of 0 or 1"
+#endif
+
+#if (RTE_LOSS_STATS > 1) || (RTE_LOSS_STATS < 0)
+#error "The RTE_LOSS_STATS must have a value of 0 or 1"
+#endif
+
+#if (RTE_DEFERRED_ERASE > 1) || (RTE_DEFERRED_ERASE < 0)
+#error "The RTE_DEFERRED_ERASE must have a value of 0 or 1"
+#endif
+
+#if (RTE_DEFERRED_ERASE != 0) && (RTE_MSG_FILTERING_ENABLED == 0)
+#error "Message filtering must be enabled for the deferred buffer erase."
+#endif
+
+#if ((RTE_CHANNELS) > 4U) || ((RTE_CHANNELS) < 1U)
+#error "The RTE_CHANNELS must have a value between min. 1 and max. 4"
+#endif
+
+#if (RTE_CHANNELS) > 1U
+#if (RTE_SMP_CORES) > 1U
+#error "Multiple logging channels cannot be used together with RTE_SMP_CORES > 1."
+#endif
+
+#if RTE_MSG_FILTERING_ENABLED == 0
+#error "Message filtering must be enabled for multiple logging channels."
+#endif
+
+#if RTE_STREAMING_ENABLED != 0
+#error "Streaming mode supports only one logging channel."
+#endif
+#endif // (RTE_CHANNELS) > 1U
+
+/* Message groups (filter numbers) logged to the additional channels.
+ * The bit layout is the same as for the filter variable (bit 31 = filter #0).
+ */
+#if !defined RTE_CHANNEL1_FILTERS
+#define RTE_CHANNEL1_FILTERS  0U
+#endif
+
+#if !defined RTE_CHANNEL2_FILTERS
+#define RTE_CHANNEL2_FILTERS  0U
+#endif
+
+#if !defined RTE_CHANNEL3_FILTERS
+#define RTE_CHANNEL3_FILTERS  0U
+#endif
+
+#if (((RTE_CHANNELS) < 2U) && ((RTE_CHANNEL1_FILTERS) != 0U)) \
+ || (((RTE_CHANNELS) < 3U) && ((RTE_CHANNEL2_FILTERS) != 0U)) \
+ || (((RTE_CHANNELS) < 4U) && ((RTE_CHANNEL3_FILTERS) != 0U))
+#error "Message groups cannot be assigned to a channel number >= RTE_CHANNELS."
+#endif
+
+#if (((RTE_CHANNEL1_FILTERS) & (RTE_CHANNEL2_FILTERS)) != 0U) \
+ || (((RTE_CHANNEL1_FILTERS) & (RTE_CHANNEL3_FILTERS)) != 0U) \
+ || (((RTE_CHANNEL2_FILTERS) & (RTE_CHANNEL3_FILTERS)) != 0U)
+#error "A message group can be assigned to only one logging channel."
+#endif
+
+#if (RTE_WRITE_POSITION > 1) || (RTE_WRITE_POSITION < 0)
+#error "The RTE_WRITE_POSITION must have a value of 0 or 1"
+#endif
+
+#if RTE_WRITE_POSITION != 0
+#if RTE_BUFF_SIZE_IS_POWER_OF_2 == 0
+#error "The free running write position requires a buffer size that is a power of 2."
+#endif
+
+#if RTE_STREAMING_ENABLED != 0
+#error "The free running write position cannot be used in streaming mode."
+#endif
+#endif // RTE_WRITE_POSITION != 0
+
+#if (RTE_SHARED_RTEDBG > 1) || (RTE_SHARED_RTEDBG < 0)
+#error "The RTE_SHARED_RTEDBG must have a value of 0 or 1"
+#endif
+
+#if (RTE_SHARED_RTEDBG != 0) && (((RTE_SMP_CORES) > 1U) || ((RTE_CHANNELS) > 1U))
+#error "The shared data logging structure cannot be used with RTE_SMP_CORES > 1 or RTE_CHANNELS > 1."
+#endif
+
+#if RTE_CACHE_LINE_SIZE != 0U
+#if ((RTE_CACHE_LINE_SIZE) != 16U) && ((RTE_CACHE_LINE_SIZE) != 32U) \
+ && ((RTE_CACHE_LINE_SIZE) != 64U) && ((RTE_CACHE_LINE_SIZE) != 128U)
+#error "The RTE_CACHE_LINE_SIZE must have a value of 0, 16, 32, 64 or 128 (bytes)."
+#endif
+
+#define RTE_CACHE_LINE_WORDS  ((RTE_CACHE_LINE_SIZE) / 4U)
+
+// Number of g_rtedbg header words before the padding - must match the rtedbg_t header
+// (checked with the static_assert() after the rtedbg_t definition)
+#define RTE_HDR_DATA_WORDS                                       \
+    (6U + ((RTE_STREAMING_ENABLED != 0) ? 2U : 0U) + ((RTE_WRITE_POSITION != 0) ? 1U : 0U) \
+     + ((RTE_LOSS_STATS != 0) ? 2U : 0U))
+
+// Padding words that align the circular buffer and the end of rtedbg_t to a cache line
+#define RTE_HDR_PAD_WORDS                                        \
+    ((RTE_CACHE_LINE_WORDS - (RTE_HDR_DATA_WORDS % RTE_CACHE_LINE_WORDS)) % RTE_CACHE_LINE_WORDS)
+#define RTE_BUF_PAD_WORDS                                        \
+    ((RTE_CACHE_LINE_WORDS - (((RTE_BUFFER_SIZE) + 4U) % RTE_CACHE_LINE_WORDS)) % RTE_CACHE_LINE_WORDS)
+
+#if (RTE_HDR_DATA_WORDS + RTE_HDR_PAD_WORDS) > 127U
+#error "The padded g_rtedbg header does not fit into the RTE_HDR_SIZE field of the rte_cfg word."
+#endif
+
+#if !defined RTE_CACHE_ALIGNED
+#define RTE_CACHE_ALIGNED  __attribute__((aligned(RTE_CACHE_LINE_SIZE)))
+#endif
+#else
+#define RTE_HDR_PAD_WORDS  0U
+#define RTE_BUF_PAD_WORDS  0U
+#undef  RTE_CACHE_ALIGNED
+#define RTE_CACHE_ALIGNED
+#endif // RTE_CACHE_LINE_SIZE != 0U
+
+#if (RTE_DUAL_BANK > 1) || (RTE_DUAL_BANK < 0)
+#error "The RTE_DUAL_BANK must have a value of 0 or 1"
+#endif
+
+#if RTE_DUAL_BANK != 0
+#if ((RTE_SMP_CORES) > 1U) || ((RTE_CHANNELS) > 1U) || (RTE_SHARED_RTEDBG != 0)
+#error "The dual-bank mode cannot be used with RTE_SMP_CORES > 1, RTE_CHANNELS > 1 or RTE_SHARED_RTEDBG."
+#endif
+
+#if (RTE_STREAMING_ENABLED != 0) || (RTE_DEFERRED_ERASE != 0) || (RTE_TRIGGER_ENABLED != 0)
+#error "The dual-bank mode cannot be used with the streaming, deferred erase or trigger mode."
+#endif
+#endif // RTE_DUAL_BANK != 0
+
+#if (RTE_FLASH_PERSIST > 1) || (RTE_FLASH_PERSIST < 0)
+#error "The RTE_FLASH_PERSIST must have a value of 0 or 1"
+#endif
+
+#if RTE_FLASH_PERSIST != 0
+#if RTE_MSG_FILTERING_ENABLED == 0
+#error "Message filtering must be enabled for the flash persistence (logging is stopped with filter = 0)."
+#endif
+
+#if !defined RTE_FLASH_ADDRESS || !defined RTE_FLASH_PROGRAM || !defined RTE_FLASH_BLOCK_SIZE
+#error "The RTE_FLASH_ADDRESS, RTE_FLASH_BLOCK_SIZE and RTE_FLASH_PROGRAM() must be defined for the flash persistence."
+#endif
+
+#if ((RTE_FLASH_BLOCK_SIZE) < 4U) || ((RTE_FLASH_BLOCK_SIZE) > 4096U) || !RTE_IS_POWER_OF_2((RTE_FLASH_BLOCK_SIZE))
+#error "The RTE_FLASH_BLOCK_SIZE must be a power of 2 between 4 and 4096 (bytes)."
+#endif
+#endif // RTE_FLASH_PERSIST != 0
+
+#if (RTE_TRIGGER_ENABLED > 1) || (RTE_TRIGGER_ENABLED < 0)
+#error "The RTE_TRIGGER_ENABLED must have a value of 0 or 1"
+#endif
+
+#if (RTE_TRIGGER_ENABLED != 0) && (RTE_MSG_FILTERING_ENABLED == 0)
+#error "Message filtering must be enabled for the trigger mode."
+#endif
+
+#if (RTE_GROUP_DECIMATION > 1) || (RTE_GROUP_DECIMATION < 0)
+#error "The RTE_GROUP_DECIMATION must have a value of 0 or 1"
+#endif
+
+#if (RTE_GROUP_DECIMATION != 0) && (RTE_MSG_FILTERING_ENABLED == 0)
+#error "Message filtering must be enabled for the message group decimation."
+#endif
+
+#if (RTE_GROUP_WORD_STATS > 1) || (RTE_GROUP_WORD_STATS < 0)
+#error "The RTE_GROUP_WORD_STATS must have a value of 0 or 1"
+#endif
+
+#if (RTE_GROUP_WORD_STATS != 0) && (RTE_MSG_FILTERING_ENABLED == 0)
+#error "Message filtering must be enabled for the message group word statistics."
+#endif
+
 
 #if RTE_MSG_FILTERING_ENABLED != 0
 #ifndef RTE_MESSAGE_DISABLED
@@ -126,6 +354,100 @@
 #endif
 #endif
 
+#if RTE_GROUP_DECIMATION != 0
+/*********************************************************************************
+ * @brief Message group decimation (RTE_GROUP_DECIMATION = 1). Only one of every
+ *        divider[n] messages of the group (filter number) n is logged. The first
+ *        message after the divider has been set is always logged. Values 0 and 1
+ *        disable the decimation of the group (default after reset).
+ *        The dividers can be changed with rte_set_decimation() or by the debug probe
+ *        (symbol g_rte_decimation) while the firmware is running.
+ *
+ * @note  The counters are not updated atomically. If a higher priority task logs a
+ *        message of the same group during the update, one message more or less may
+ *        be logged. The counters are common to all CPU cores and logging channels.
+ *********************************************************************************/
+typedef struct
+{
+    volatile uint32_t divider[32];  /*!< Log one of every divider[n] messages of group n */
+    volatile uint32_t counter[32];  /*!< Number of messages skipped since the last logged one */
+} rte_decimation_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern rte_decimation_t g_rte_decimation;
+#ifdef __cplusplus
+}
+#endif
+
+/*********************************************************************************
+ * @brief Check whether a message of the group should be skipped by the decimation.
+ *
+ * @param  group  Message group (filter number)
+ * @return 0 - log the message, 1 - skip the message
+ *********************************************************************************/
+__STATIC_FORCEINLINE uint32_t rte_group_decimated(const uint32_t group)
+{
+    const uint32_t divider = g_rte_decimation.divider[group & 0x1FU];
+    if (divider <= 1U)
+    {
+        return 0U;
+    }
+
+    const uint32_t count = g_rte_decimation.counter[group & 0x1FU];
+    g_rte_decimation.counter[group & 0x1FU] = ((count + 1U) >= divider) ? 0U : (count + 1U);
+    return (count != 0U) ? 1U : 0U;
+}
+
+// Filter check followed by the decimation of the messages that passed the filter
+#define RTE_MESSAGE_SKIPPED(filter, fmt, shift_bits)                 \
+    (RTE_MESSAGE_DISABLED(filter, fmt, shift_bits)                   \
+     || (rte_group_decimated((fmt) >> ((uint32_t)(RTE_FMT_ID_BITS) - (shift_bits))) != 0U))
+#else
+#define RTE_MESSAGE_SKIPPED(filter, fmt, shift_bits)  RTE_MESSAGE_DISABLED(filter, fmt, shift_bits)
+#endif // RTE_GROUP_DECIMATION != 0
+
+#if RTE_GROUP_WORD_STATS != 0
+/*********************************************************************************
+ * @brief Message group bandwidth statistics (RTE_GROUP_WORD_STATS = 1).
+ *        g_rte_group_words[n] is the number of circular buffer words reserved by the
+ *        messages of the group (filter number) n. The counters are free running
+ *        (modulo 2^32) and are not reset by rte_init(). The host can read the array
+ *        (symbol g_rte_group_words) periodically with a debug probe and compute the
+ *        number of words per second for each group from the difference.
+ *
+ * @note  The counters are not updated atomically. A count may occasionally be lost
+ *        if a higher priority task logs a message of the same group during the update.
+ *        The counters are common to all CPU cores and logging channels.
+ *********************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern volatile uint32_t g_rte_group_words[32];
+#ifdef __cplusplus
+}
+#endif
+
+/*********************************************************************************
+ * @brief Add the message size to the word counter of its group. Executed after
+ *        the space for a message has been reserved.
+ *
+ * @param fmt_id      Packed format ID of the message
+ * @param shift_bits  Number of bits the format ID was shifted right by RTE_PACK()
+ * @param size        Message size (number of words)
+ *********************************************************************************/
+#define RTE_COUNT_GROUP_WORDS(fmt_id, shift_bits, size)                              \
+    {                                                                                \
+        const uint32_t rte_group =                                                   \
+            ((fmt_id) >> ((uint32_t)(RTE_FMT_ID_BITS) - (shift_bits))) & 0x1FU;      \
+        /* Not a compound assignment - deprecated for volatile operands in C++20 */  \
+        g_rte_group_words[rte_group] = g_rte_group_words[rte_group] + (size);        \
+    }
+#else
+#define RTE_COUNT_GROUP_WORDS(fmt_id, shift_bits, size)
+#endif // RTE_GROUP_WORD_STATS != 0
+
 // Empty optimization definitions if the rtedbg.c file optimization will be set in
 // the IDE (or makefile) or inherited from the complete project setup.
 #if !defined RTE_OPTIMIZE_CODE
@@ -158,6 +480,8 @@ typedef struct
     volatile uint32_t buf_index;
         /*!< Index to the circular data logging buffer.
          *   It points to the location where the next message will be written.
+         *   If RTE_WRITE_POSITION = 1, it is a free running write position - see
+         *   the index_mask description.
          */
     volatile uint32_t filter;
         /*!< Enable/disable 32 message filters - each bit enables a group of messages.
@@ -178,6 +502,47 @@ typedef struct
         /*!< The size of the circular data logging buffer  (RTE_BUFFER_SIZE + 4).
              It includes four additional words at the end of the buffer to speed up data logging.
          */
+#if RTE_STREAMING_ENABLED != 0
+    volatile uint32_t rd_index;
+        /*!< Streaming mode - index of the first word not yet read by rte_stream_read().
+         *   The data between rd_index and buf_index has not been transferred yet.
+         */
+    volatile uint32_t overrun_count;
+        /*!< Streaming mode - number of messages discarded because they would overwrite
+         *   data not yet read by rte_stream_read().
+         */
+#endif
+#if RTE_WRITE_POSITION != 0
+    uint32_t index_mask;
+        /*!< RTE_BUFFER_SIZE - 1. The buf_index is not limited to the buffer size but
+         *   increases with every reserved word (modulo 2^32). The index of the next
+         *   message is (buf_index & index_mask) and the number of times the buffer
+         *   has been filled is (buf_index / (index_mask + 1)). The host software can
+         *   thus read only the words written since its last snapshot and detect
+         *   that it has fallen behind (the difference is larger than the buffer size).
+         */
+#endif
+#if RTE_LOSS_STATS != 0
+    volatile uint32_t too_long_count;
+        /*!< Number of messages longer than the maximum message size (RTE_MAX_MSG_SIZE,
+         *   RTE_MAX_MSGX_SIZE - 1 for __rte_msgx() and __rte_delta_msg() or
+         *   RTE_MAX_BATCH_MESSAGES for __rte_msg_batch()). The messages have been
+         *   discarded or truncated - see RTE_DISCARD_TOO_LONG_MESSAGES.
+         */
+    volatile uint32_t buffer_full_count;
+        /*!< Single-shot mode - number of messages discarded because there was not
+         *   enough space left in the circular buffer. Messages discarded in streaming
+         *   mode are counted in the overrun_count.
+         */
+#endif
+#if RTE_HDR_PAD_WORDS != 0U
+    uint32_t header_padding[RTE_HDR_PAD_WORDS];
+        /*!< RTE_CACHE_LINE_SIZE != 0 - the circular buffer starts at a cache line
+         *   boundary, so that the buffer writes of another CPU core or a DMA/debug probe
+         *   access of the buffer do not share a cache line with the header. The host
+         *   software skips the padding - it is part of the header size in rte_cfg.
+         */
+#endif
     //---- g_rtedbg structure header end -----------------------------------
 
     uint32_t buffer[(uint32_t)(RTE_BUFFER_SIZE) + 4U];
@@ -186,9 +551,112 @@ typedef struct
          * the code, since the check to see if the index is already at the end of the
          * buffer is performed only once per data subpacket.
          */
+#if RTE_BUF_PAD_WORDS != 0U
+    uint32_t buffer_padding[RTE_BUF_PAD_WORDS];
+        /*!< RTE_CACHE_LINE_SIZE != 0 - the size of rtedbg_t is a multiple of the cache
+         *   line size. The header of the next per-core structure (RTE_SMP_CORES > 1)
+         *   or another variable cannot share a cache line with the buffer trailer.
+         */
+#endif
 } rtedbg_t;
 
+#if (RTE_ENABLED != 0) && ((RTE_CACHE_LINE_SIZE) != 0U)
+static_assert((offsetof(rtedbg_t, buffer) % (RTE_CACHE_LINE_SIZE)) == 0U,
+    "The rtedbg_t header size does not match RTE_HDR_DATA_WORDS - the buffer is not cache line aligned.");
+static_assert((sizeof(rtedbg_t) % (RTE_CACHE_LINE_SIZE)) == 0U,
+    "The rtedbg_t size is not a multiple of the cache line size.");
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#if (RTE_SMP_CORES) > 1U
+/* Each CPU core logs to its own data logging structure. Space reservation is done
+ * only in the structure of the local core, so the CPU cores do not compete for the
+ * same buf_index. All structures have the same layout. Structure #n is located at
+ * address &g_rtedbg[0] + n * sizeof(rtedbg_t), and the number of structures is
+ * defined in bits 5..7 of the rte_cfg word. The host software can read and decode
+ * each of them separately and merge the messages by timestamp.
+ */
+extern rtedbg_t g_rtedbg[RTE_SMP_CORES];     // Data logging structures - one per CPU core
+#define RTE_LOCAL_RTEDBG()      (&g_rtedbg[RTE_GET_CORE_ID()])
+#define RTE_CORE_RTEDBG(core)   (&g_rtedbg[(core)])
+#elif (RTE_CHANNELS) > 1U
+/* Channel #0 is the g_rtedbg structure, the others are g_rtedbg_ch1 ... g_rtedbg_ch3.
+ * All of them have the same layout and can be placed in different memory sections.
+ * The host software finds them with the g_rte_channel_table descriptor and decodes
+ * each of them separately. Messages are routed to the channels by the filter number
+ * (message group) - see RTE_CHANNEL1_FILTERS ... RTE_CHANNEL3_FILTERS.
+ */
+typedef struct
+{
+    uint32_t count;                         // Number of logging channels
+    rtedbg_t *channel[RTE_CHANNELS];        // Addresses of the channel data structures
+} rte_channel_table_t;
+
+extern rtedbg_t g_rtedbg;       // Data logging structure of channel #0
+extern rtedbg_t g_rtedbg_ch1;   // Data logging structure of channel #1
+#if (RTE_CHANNELS) > 2U
+extern rtedbg_t g_rtedbg_ch2;   // Data logging structure of channel #2
+#endif
+#if (RTE_CHANNELS) > 3U
+extern rtedbg_t g_rtedbg_ch3;   // Data logging structure of channel #3
+#endif
+extern const rte_channel_table_t g_rte_channel_table;
+extern rtedbg_t * const g_rte_filter_channel[32];   // Channel for each filter number
+#define RTE_LOCAL_RTEDBG()      (&g_rtedbg)
+#define RTE_CORE_RTEDBG(index)  (g_rte_channel_table.channel[(index)])
+#define RTE_MSG_RTEDBG(fmt_id, shift_bits) \
+    (g_rte_filter_channel[((fmt_id) >> ((uint32_t)(RTE_FMT_ID_BITS) - (shift_bits))) & 0x1FU])
+#elif RTE_DUAL_BANK != 0
+/* Two data logging structures (banks) - g_rtedbg and g_rtedbg_bank1. Messages are
+ * logged to the active bank. The rte_bank_swap() erases the inactive bank and makes
+ * it the active one, so that the host can read the previously active bank while
+ * the logging continues. The host software finds the banks with the g_rte_bank_table.
+ */
+typedef struct
+{
+    rtedbg_t * volatile active_bank;        // Bank used by the data logging functions
+    volatile uint32_t active;               // Number of the active bank (0 or 1)
+    volatile uint32_t swap_count;           // Incremented when a bank is ready to be read
+    volatile uint32_t read_count;           // The host sets it to swap_count after reading the bank
+    rtedbg_t *bank[2];                      // Addresses of the bank data structures
+} rte_bank_table_t;
+
+extern rtedbg_t g_rtedbg;       // Data logging structure of bank #0
+extern rtedbg_t g_rtedbg_bank1; // Data logging structure of bank #1
+extern rte_bank_table_t g_rte_bank_table;
+#define RTE_LOCAL_RTEDBG()      (g_rte_bank_table.active_bank)
+#define RTE_CORE_RTEDBG(index)  (g_rte_bank_table.bank[(index)])
+#elif RTE_SHARED_RTEDBG != 0
+/* The data logging structure is located at the address set by rte_set_rtedbg() - e.g.
+ * in a shared memory block mapped by several processes and by the data collector.
+ * The g_rtedbg structure is used until the address is set (message logging is
+ * disabled in it since it has not been initialized by rte_init()).
+ */
+extern rtedbg_t g_rtedbg;               // Data logging structure used until rte_set_rtedbg()
+extern rtedbg_t *g_rte_shared_rtedbg;   // Address of the data logging structure
+#define RTE_LOCAL_RTEDBG()      (g_rte_shared_rtedbg)
+#define RTE_CORE_RTEDBG(core)   (g_rte_shared_rtedbg)
+#else
 extern rtedbg_t g_rtedbg;   // Global data logging structure
+#define RTE_LOCAL_RTEDBG()      (&g_rtedbg)
+#define RTE_CORE_RTEDBG(core)   (&g_rtedbg)
+#endif
+
+/* Data logging structure for a message with the packed fmt_id (see RTE_PACK()). */
+#if !defined RTE_MSG_RTEDBG
+#define RTE_MSG_RTEDBG(fmt_id, shift_bits)  RTE_LOCAL_RTEDBG()
+#endif
+
+/* Number of data logging structures - per CPU core or per logging channel. */
+#define RTE_RTEDBG_COUNT  \
+    ((uint32_t)(RTE_SMP_CORES) * (uint32_t)(RTE_CHANNELS) * ((RTE_DUAL_BANK != 0) ? 2U : 1U))
+
+#ifdef __cplusplus
+}
+#endif
 
 /*********************************************************************************
  * @brief Union defined to move the top bit of 32-bit data words into an FMT word
@@ -211,16 +679,259 @@ typedef union
 #define RTE_PARAM(par)  par
 #endif
 
+/*********************************************************************************
+ * @brief Message loss statistics (RTE_LOSS_STATS = 1). Increment one of the loss
+ *        counters in the g_rtedbg header - see too_long_count and buffer_full_count.
+ *
+ * @note  The counters are not updated atomically. A count may occasionally be lost
+ *        if a higher priority task discards a message while the counter is updated.
+ *********************************************************************************/
+#if RTE_LOSS_STATS != 0
+#define RTE_COUNT_LOST(ptr, counter)  (ptr)->counter = (ptr)->counter + 1U
+#else
+#define RTE_COUNT_LOST(ptr, counter)
+#endif
+
+/* Single-shot mode - executed by the RTE_RESERVE_SPACE() macros before the message
+ * that does not fit into the circular buffer is discarded.
+ */
 #if defined RTE_STOP_SINGLE_SHOT_AT_FIRST_TOO_LARGE_MSG
-#define RTE_STOP_MESSAGE_LOGGING()  ptr->filter = 0
+#define RTE_STOP_MESSAGE_LOGGING(ptr)                                                \
+    do                                                                               \
+    {                                                                                \
+        RTE_COUNT_LOST(ptr, buffer_full_count);                                      \
+        (ptr)->filter = 0U;                                                          \
+    }                                                                                \
+    while (0)
 #else
-#define RTE_STOP_MESSAGE_LOGGING()
+#define RTE_STOP_MESSAGE_LOGGING(ptr)  RTE_COUNT_LOST(ptr, buffer_full_count)
 #endif
 
 #ifndef RTE_DATA_MEMORY_BARRIER
 #define RTE_DATA_MEMORY_BARRIER()
 #endif
 
+/*********************************************************************************
+ * @brief Streaming mode - discard the message if it would overwrite the data that
+ *        has not yet been read by rte_stream_read(). Used by the RTE_RESERVE_SPACE()
+ *        macros after the index was limited to the buffer size.
+ *
+ * @param ptr        Pointer to the data logging structure
+ * @param index      Index of the first word of the message
+ * @param size       Message size (number of words)
+ * @param exit_code  Code that must be executed before the return (e.g. __CLREX())
+ *********************************************************************************/
+#if RTE_STREAMING_ENABLED != 0
+#define RTE_STREAM_CHECK_SPACE(ptr, index, size, exit_code)                          \
+    RTE_STREAM_CHECK_SPACE_RD(ptr, index, ptr->rd_index, size, exit_code)
+
+/* Version with the read index loaded by the caller - e.g. before the LR.W instruction
+ * of a RISC-V driver, so that there is no additional load between the LR.W and SC.W.
+ */
+#define RTE_STREAM_CHECK_SPACE_RD(ptr, index, rd_idx, size, exit_code)               \
+    if (((((index) - (rd_idx)) & ((uint32_t)(RTE_BUFFER_SIZE) - 1U)) + (size))       \
+        >= (uint32_t)(RTE_BUFFER_SIZE))                                              \
+    {                                                                                \
+        ptr->overrun_count = ptr->overrun_count + 1U;                                \
+        exit_code;                                                                   \
+        return;        /* Exit the __rte_msg?() function. */                         \
+    }
+#else
+#define RTE_STREAM_CHECK_SPACE(ptr, index, size, exit_code)
+#define RTE_STREAM_CHECK_SPACE_RD(ptr, index, rd_idx, size, exit_code)
+#endif
+
+#if RTE_RESERVATION_STATS != 0
+/*********************************************************************************
+ * @brief Buffer space reservation statistics (RTE_RESERVATION_STATS = 1).
+ *        The structure is separate from g_rtedbg so that the layout of the data
+ *        logging structure does not change. The host can read it with a debug probe
+ *        (symbol g_rte_reservation_stats) together with the g_rtedbg structure.
+ *
+ * @note  The counters are not updated atomically. A count may occasionally be lost
+ *        if a higher priority task logs a message while the counters are updated.
+ *********************************************************************************/
+typedef struct
+{
+    volatile uint32_t attempts;
+        /*!< Number of buffer space reservations (messages for which space was reserved). */
+    volatile uint32_t retries;
+        /*!< Total number of repeated reservation attempts - the load/store exclusive or
+         *   compare-and-swap failed because another task or ISR reserved space first.
+         */
+    volatile uint32_t max_retries;
+        /*!< Largest number of repeated attempts for a single reservation. */
+} rte_reservation_stats_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+#if (RTE_SMP_CORES) > 1U
+extern rte_reservation_stats_t g_rte_reservation_stats[RTE_SMP_CORES];  // One per CPU core
+#define RTE_LOCAL_RES_STATS()   (&g_rte_reservation_stats[RTE_GET_CORE_ID()])
+#else
+extern rte_reservation_stats_t g_rte_reservation_stats;
+#define RTE_LOCAL_RES_STATS()   (&g_rte_reservation_stats)
+#endif
+#ifdef __cplusplus
+}
+#endif
+
+/*********************************************************************************
+ * @brief Hooks for the RTE_RESERVE_SPACE() macros of the CPU drivers.
+ *        RTE_RES_STATS_START() - declare the counter of the reservation loop passes
+ *        RTE_RES_STATS_PASS()  - executed at the start of every reservation loop pass
+ *        RTE_RES_STATS_END()   - executed after the space has been reserved
+ *********************************************************************************/
+#define RTE_RES_STATS_START()   uint32_t rte_res_passes = 0U;
+#define RTE_RES_STATS_PASS()    rte_res_passes++;
+#define RTE_RES_STATS_END()                                                          \
+    {                                                                                \
+        rte_reservation_stats_t *p_stats = RTE_LOCAL_RES_STATS();                    \
+        uint32_t rte_res_retries = rte_res_passes - 1U;                              \
+        p_stats->attempts = p_stats->attempts + 1U;                                  \
+        p_stats->retries = p_stats->retries + rte_res_retries;                       \
+        if (rte_res_retries > p_stats->max_retries)                                  \
+        {                                                                            \
+            p_stats->max_retries = rte_res_retries;                                  \
+        }                                                                            \
+    }
+#else
+#define RTE_RES_STATS_START()
+#define RTE_RES_STATS_PASS()
+#define RTE_RES_STATS_END()
+#endif
+
+#if RTE_TRIGGER_ENABLED != 0
+/*********************************************************************************
+ * @brief Trigger mode (RTE_TRIGGER_ENABLED = 1). The data is logged circularly
+ *        until the trigger - the rte_trigger() call or the message with the trigger
+ *        format ID. After the trigger, post_words words are logged and then the
+ *        message logging is stopped by setting the filter of all data logging
+ *        structures to zero. The circular buffer then contains the data logged
+ *        before and after the trigger. The host software can read the structure
+ *        (symbol g_rte_trigger) to find the message that caused the trigger.
+ *
+ * @note  The remaining word count is not updated atomically. If several tasks log
+ *        messages at the same time, a few words more may be logged after the trigger.
+ *********************************************************************************/
+typedef struct
+{
+    volatile uint32_t state;
+        /*!< RTE_TRIGGER_OFF, RTE_TRIGGER_ARMED, RTE_TRIGGER_POST or RTE_TRIGGER_DONE */
+    volatile uint32_t trigger_fmt;
+        /*!< Format ID that triggers the capture or RTE_TRIGGER_NO_FMT */
+    volatile uint32_t post_words;
+        /*!< Number of words to be logged after the trigger */
+    volatile uint32_t remaining;
+        /*!< Number of words to be logged before the message logging is stopped */
+    volatile uint32_t index;
+        /*!< buf_index value at the trigger (start of the triggering message) */
+    volatile uint32_t trigger_mask;
+        /*!< Format ID bits compared with trigger_fmt (the extended data bits are zero) */
+} rte_trigger_t;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+extern rte_trigger_t g_rte_trigger;
+void __rte_trigger_check(const uint32_t fmt, const uint32_t index, const uint32_t size);
+#ifdef __cplusplus
+}
+#endif
+
+/*********************************************************************************
+ * @brief Check the trigger condition or count the post-trigger words. Executed after
+ *        the space for a message has been reserved. Only a single compare is added to
+ *        the logging functions if the trigger mode is not active.
+ *
+ * @param fmt_id      Packed format ID of the message
+ * @param shift_bits  Number of bits the format ID was shifted right by RTE_PACK()
+ * @param index       Index of the first word of the message
+ * @param size        Message size (number of words)
+ *********************************************************************************/
+#define RTE_TRIGGER_CHECK(fmt_id, shift_bits, index, size)                           \
+    if (g_rte_trigger.state != RTE_TRIGGER_OFF)                                      \
+    {                                                                                \
+        __rte_trigger_check(((fmt_id) << (shift_bits))                               \
+                            & ((1UL << (uint32_t)(RTE_FMT_ID_BITS)) - 1U),           \
+                            (index), (size));                                        \
+    }
+#else
+#define RTE_TRIGGER_CHECK(fmt_id, shift_bits, index, size)
+#endif // RTE_TRIGGER_ENABLED != 0
+
+#if (RTE_AUTO_LONG_TIMESTAMP > 1) || (RTE_AUTO_LONG_TIMESTAMP < 0)
+#error "The RTE_AUTO_LONG_TIMESTAMP must have a value of 0 or 1"
+#endif
+
+#if RTE_AUTO_LONG_TIMESTAMP != 0
+#if RTE_USE_LONG_TIMESTAMP == 0
+#error "The RTE_USE_LONG_TIMESTAMP must be enabled for the automatic long timestamps."
+#endif
+
+/*********************************************************************************
+ * @brief Automatic long timestamps (RTE_AUTO_LONG_TIMESTAMP = 1). The state word
+ *        counts the changes of the top bit of the timestamp in the FMT words - i.e.
+ *        (timestamp counter >> (30 - RTE_FMT_ID_BITS + RTE_TIMESTAMP_SHIFT)),
+ *        extended to 32 bits. Its bit 0 is thus always equal to the top bit of the
+ *        last timestamp seen. The long timestamp (state >> 1) is logged when the
+ *        timestamp bits in the FMT words wrap around (top bit changes to 0).
+ *
+ * @note  The state is changed only to (old value + 1) derived from the state read
+ *        before the timestamp counter. If several tasks detect the change at the same
+ *        time, all write the same value - no locking or atomic instructions are
+ *        used. The long timestamp message may then be logged more than once (e.g.
+ *        if an interrupt logs a message between the state read and write).
+ *********************************************************************************/
+#ifdef __cplusplus
+extern "C" {
+#endif
+#if (RTE_SMP_CORES) > 1U
+extern volatile uint32_t g_rte_long_tstamp[RTE_SMP_CORES];  // One per CPU core
+#define RTE_LOCAL_LONG_TSTAMP()  (g_rte_long_tstamp[RTE_GET_CORE_ID()])
+#else
+extern volatile uint32_t g_rte_long_tstamp;
+#define RTE_LOCAL_LONG_TSTAMP()  (g_rte_long_tstamp)
+#endif
+#ifdef __cplusplus
+}
+#endif
+
+// Number of the timestamp counter bit that is the top bit of the timestamp in the FMT words
+#define RTE_TSTAMP_TOP_BIT  (30U - (uint32_t)(RTE_FMT_ID_BITS) + (uint32_t)(RTE_TIMESTAMP_SHIFT))
+
+/*********************************************************************************
+ * @brief Check if the top bit of the message timestamp has changed since the last
+ *        message. Only a compare is added to the logging functions - the state is
+ *        updated and the long timestamp logged by rte_long_timestamp_check().
+ *
+ * @param timestamp  Timestamp of the message (before the FMT word bits are added)
+ *********************************************************************************/
+#define RTE_LONG_TIMESTAMP_CHECK(timestamp)                                          \
+    if (((((timestamp) >> (31U - (uint32_t)(RTE_FMT_ID_BITS))) ^ RTE_LOCAL_LONG_TSTAMP()) & 1U) != 0U) \
+    {                                                                                \
+        rte_long_timestamp_check();                                                  \
+    }
+
+/*********************************************************************************
+ * @brief Check executed before the space for the message is reserved. The delayed
+ *        timestamp (RTE_DELAYED_TSTAMP_READ = 1) is read after the reservation, but
+ *        the long timestamp message must be logged before the message with the
+ *        wrapped timestamp bits. The timestamp counter is thus read once more here.
+ *        A wrap around between this check and the delayed timestamp read is detected
+ *        by the next logged message - the long timestamp is then logged after it.
+ *********************************************************************************/
+#if RTE_DELAYED_TSTAMP_READ != 0
+#define RTE_LONG_TIMESTAMP_PRECHECK()  RTE_LONG_TIMESTAMP_CHECK(rte_get_timestamp() >> ((RTE_TIMESTAMP_SHIFT) - 1U))
+#else
+#define RTE_LONG_TIMESTAMP_PRECHECK()
+#endif
+#else
+#define RTE_LONG_TIMESTAMP_CHECK(timestamp)
+#define RTE_LONG_TIMESTAMP_PRECHECK()
+#endif // RTE_AUTO_LONG_TIMESTAMP != 0
+
 #if (RTE_TIMESTAMP_SHIFT) < 1U
 #error "The timestamp shift value must be one or more."
 #endif
@@ -250,6 +961,27 @@ typedef union
 #define RTE_FALLTHROUGH  // Compiler might not support preprocessor checks for attributes
 #endif  // defined __has_attribute
 
+/* Word-aligned __rte_msgx() data can be copied as 32-bit words on little-endian CPU
+ * cores because the byte order in the DATA words is the same. Define the value of
+ * RTE_MSGX_WORD_ACCESS in the rtedbg_config.h if the compiler does not provide the
+ * endianness information (1 - little-endian CPU core, 0 - copy data byte by byte).
+ */
+#if !defined RTE_MSGX_WORD_ACCESS
+#if defined __BYTE_ORDER__ && defined __ORDER_LITTLE_ENDIAN__
+#if __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define RTE_MSGX_WORD_ACCESS  1
+#endif
+#elif defined __LITTLE_ENDIAN__
+#if (__LITTLE_ENDIAN__ + 0) != 0
+#define RTE_MSGX_WORD_ACCESS  1
+#endif
+#endif
+#endif  // !defined RTE_MSGX_WORD_ACCESS
+
+#if !defined RTE_MSGX_WORD_ACCESS
+#define RTE_MSGX_WORD_ACCESS  0
+#endif
+
 #endif /* RTEDBG_INT_H */
 
 /*==== End of file ====*/
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2024 Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rtedbg_cortex_m_itm.h
+ * @author  Branko Premzel
+ * @version RTEdbg library <DEVELOPMENT BRANCH>
+ *
+ * @brief  ARM Cortex-M3/M4/M7/M33 driver that sends every logged message to an ITM
+ *         stimulus port (SWO output) in addition to writing it to the circular buffer.
+ *         The messages are sent in the same binary format as they are stored in the
+ *         g_rtedbg buffer (subpackets with DATA words and the FMT word). The debug
+ *         probe streams them continuously - no drain task and no streaming mode
+ *         functions are needed.
+ *         Select it in the rtedbg_config.h instead of the "rtedbg_cortex_m_mutex.h":
+ *             #define RTE_CPU_DRIVER  "rtedbg_cortex_m_itm.h"
+ *             #define RTE_ITM_PORT    1U      // Stimulus port number (default 0)
+ *         The buffer space is reserved with the exclusive access instructions (see
+ *         rtedbg_cortex_m_mutex.h). The message is sent to the stimulus port after
+ *         it has been written to the circular buffer.
+ *
+ * @note   The ITM and the stimulus port must be enabled by the debugger (ITM->TCR,
+ *         ITM->TER). The messages are not sent if they are not enabled - e.g. if the
+ *         debug probe is not connected.
+ *
+ * @note   The circular buffer is also the staging area for the ITM output. If the
+ *         post-mortem data is not needed, a small buffer can be used (e.g. 256 words).
+ *         It must be large enough for all messages that can be logged by the
+ *         interrupts while a task is writing a message. An older message is
+ *         otherwise overwritten before it is sent.
+ *
+ * @note   The interrupts are disabled while the words of a message are written to
+ *         the stimulus port so that messages are not mixed in the SWO data stream.
+ *         The time depends on the message length and the SWO speed if the ITM FIFO
+ *         is full. Messages logged by interrupts may be sent before a message logged
+ *         earlier by an interrupted task - the host software sorts them by timestamp.
+ ******************************************************************************/
+
+#ifndef RTEDBG_CORTEX_M_ITM_H
+#define RTEDBG_CORTEX_M_ITM_H
+
+#include "rtedbg_cortex_m_mutex.h"  // Buffer space reservation
+
+#if !defined RTE_ITM_PORT
+#define RTE_ITM_PORT    0U          // ITM stimulus port number (0 ... 31)
+#endif
+
+#if (RTE_ITM_PORT) > 31U
+#error "The RTE_ITM_PORT must have a value from 0 to 31."
+#endif
+
+#if (RTE_SMP_CORES) > 1U
+#error "The ITM driver is for single-core logging - the ITM unit is core-specific."
+#endif
+
+#if RTE_STREAMING_ENABLED != 0
+#error "The ITM output replaces the streaming mode - set RTE_STREAMING_ENABLED to 0."
+#endif
+
+
+/********************************************************************************
+ * @brief  Send a message from the circular buffer to the ITM stimulus port.
+ *         The message consists of one or more subpackets. Each subpacket ends
+ *         with the FMT word - the only word with bit 0 set. The next subpacket
+ *         starts at the index limited with RTE_LIMIT_INDEX() - as written by the
+ *         data logging functions.
+ *
+ * @param  buffer  Circular buffer of the data logging structure
+ * @param  index   Index of the first word of the message
+ * @param  size    Number of message words
+ ********************************************************************************/
+
+__STATIC_INLINE void rte_itm_output(const uint32_t * const buffer, uint32_t index, uint32_t size)
+{
+    if (((ITM->TCR & ITM_TCR_ITMENA_Msk) == 0UL) || ((ITM->TER & (1UL << (RTE_ITM_PORT))) == 0UL))
+    {
+        return;     // ITM or the stimulus port not enabled by the debugger
+    }
+
+    const uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+
+    while (size != 0U)
+    {
+        uint32_t length = 0U;
+        uint32_t word;
+
+        do
+        {
+            word = buffer[index + length];
+            while (ITM->PORT[RTE_ITM_PORT].u32 == 0UL)
+            {
+                // Wait until the ITM FIFO can accept the next word
+            }
+            ITM->PORT[RTE_ITM_PORT].u32 = word;
+            length++;
+        }
+        while (((word & 1U) == 0U) && (length < size) && (length < 5U));
+
+        size -= length;
+        index += length;
+        RTE_LIMIT_INDEX(index)
+    }
+
+    __set_PRIMASK(primask);
+}
+
+#define RTE_MSG_OUTPUT(buffer, index, size)  rte_itm_output((buffer), (index), (size));
+
+#endif  // RTEDBG_CORTEX_M_ITM_H
+
+/*==== End of file ====*/
@@ -16,7 +16,7 @@
  *
  * @note   This driver version is suitable for single-core devices or multi-core
  *         devices where data logging is performed for only one core or separately
- *         for each core.
+ *         for each core (see RTE_SMP_CORES in the rtedbg_config_template.h).
  *         Use the generic symmetric multi-core device driver with support for 
  *         the atomic operations library in "rtedbg_generic_atomic_smp.h" and follow
  *         the instructions in the readme and RTEdbg manual if you plan to use a
@@ -43,14 +43,20 @@
  */
 #define RTE_RESERVE_SPACE(ptr, buf_idx, size)                               \
 do {                                                                        \
+    RTE_RES_STATS_START()                                                   \
+    uint32_t rte_raw_index;                                                 \
     uint32_t new_index;                                                     \
     do                                                                      \
     {                                                                       \
-        buf_idx = __LDREXW(&ptr->buf_index);                                \
+        RTE_RES_STATS_PASS()                                                \
+        rte_raw_index = __LDREXW(&ptr->buf_index);                          \
+        buf_idx = rte_raw_index;                                            \
         RTE_LIMIT_INDEX(buf_idx)                                            \
-        new_index = buf_idx + (size);                                       \
+        RTE_STREAM_CHECK_SPACE(ptr, buf_idx, size, __CLREX())               \
+        new_index = RTE_NEXT_INDEX(rte_raw_index, buf_idx, size);           \
     }                                                                       \
     while (__STREXW(new_index, &ptr->buf_index) != 0);                      \
+    RTE_RES_STATS_END()                                                     \
 } while(0)
 
 #else   /* RTE_SINGLE_SHOT_ENABLED == 1 */
@@ -61,24 +67,29 @@ do {                                                                        \
  */
 #define RTE_RESERVE_SPACE(ptr, buf_idx, size)                               \
 do {                                                                        \
+    RTE_RES_STATS_START()                                                   \
+    uint32_t rte_raw_index;                                                 \
     uint32_t new_index;                                                     \
     do                                                                      \
     {                                                                       \
-        buf_idx = __LDREXW(&ptr->buf_index);                                \
+        RTE_RES_STATS_PASS()                                                \
+        rte_raw_index = __LDREXW(&ptr->buf_index);                          \
+        buf_idx = rte_raw_index;                                            \
         if (ptr->rte_cfg & RTE_SINGLE_SHOT_LOGGING_IS_ACTIVE)               \
         {                                                                   \
             /* Check if there is enough space for the complete message */   \
             if ((buf_idx + (size)) >= (uint32_t)(RTE_BUFFER_SIZE))          \
             {                                                               \
-               RTE_STOP_MESSAGE_LOGGING();                                  \
+               RTE_STOP_MESSAGE_LOGGING(ptr);                               \
                __CLREX();                                                   \
                return;           /* Exit the __rte_msg function. */         \
             }                                                               \
         }                                                                   \
         RTE_LIMIT_INDEX(buf_idx)                                            \
-        new_index = buf_idx + (size);                                       \
+        new_index = RTE_NEXT_INDEX(rte_raw_index, buf_idx, size);           \
     }                                                                       \
     while (__STREXW(new_index, &ptr->buf_index) != 0);                      \
+    RTE_RES_STATS_END()                                                     \
 } while(0)
 
 #endif /* RTE_SINGLE_SHOT_ENABLED == 0 */
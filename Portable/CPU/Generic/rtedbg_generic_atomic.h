@@ -38,17 +38,21 @@
 #define RTE_RESERVE_SPACE(ptr, index, size)                                   \
 do                                                                            \
 {                                                                             \
+    RTE_RES_STATS_START()                                                     \
     _Atomic uint32_t *buff_idx = (_Atomic uint32_t *)&ptr->buf_index;         \
     uint32_t temp;                                                            \
     do                                                                        \
     {                                                                         \
+        RTE_RES_STATS_PASS()                                                  \
         temp = atomic_load_explicit(buff_idx, memory_order_relaxed);          \
         index = temp;                                                         \
         RTE_LIMIT_INDEX(index)                                                \
+        RTE_STREAM_CHECK_SPACE(ptr, index, size, (void)0)                     \
     }                                                                         \
     while (!atomic_compare_exchange_weak_explicit(                            \
-            buff_idx, &temp, index + (size),                                  \
+            buff_idx, &temp, RTE_NEXT_INDEX(temp, index, size),               \
             memory_order_relaxed, memory_order_relaxed));                     \
+    RTE_RES_STATS_END()                                                       \
 } while(0)
 
 #else   /* RTE_SINGLE_SHOT_ENABLED == 1 */
@@ -60,10 +64,12 @@ do                                                                            \
 
 #define RTE_RESERVE_SPACE(ptr, index, size)                                   \
 do {                                                                          \
+    RTE_RES_STATS_START()                                                     \
     _Atomic uint32_t *buff_idx = (_Atomic uint32_t *)&ptr->buf_index;         \
     uint32_t temp;                                                            \
     do                                                                        \
     {                                                                         \
+        RTE_RES_STATS_PASS()                                                  \
         temp = atomic_load_explicit(buff_idx, memory_order_relaxed);          \
         index = temp;                                                         \
         if (ptr->rte_cfg & RTE_SINGLE_SHOT_LOGGING_IS_ACTIVE)                 \
@@ -71,15 +77,16 @@ do {                                                                          \
             /* Check if there is enough space for the complete message */     \
             if ((index + (size)) >= (uint32_t)(RTE_BUFFER_SIZE))              \
             {                                                                 \
-                RTE_STOP_MESSAGE_LOGGING();                                   \
+                RTE_STOP_MESSAGE_LOGGING(ptr);                                \
                 return;           /* Exit the __rte_msg() function. */        \
             }                                                                 \
         }                                                                     \
         RTE_LIMIT_INDEX(index)                                                \
     }                                                                         \
     while (!atomic_compare_exchange_weak_explicit(                            \
-            buff_idx, &temp, index + (size),                                  \
+            buff_idx, &temp, RTE_NEXT_INDEX(temp, index, size),               \
             memory_order_relaxed, memory_order_relaxed));                     \
+    RTE_RES_STATS_END()                                                       \
 } while(0)
 
 #endif /* RTE_SINGLE_SHOT_ENABLED == 0 */
@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2024 Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rtedbg_generic_atomic_fetch_add.h
+ * @author  Branko Premzel
+ * @version RTEdbg library <DEVELOPMENT BRANCH>
+ *
+ * @brief  Circular buffer space reservation with a single atomic fetch-and-add
+ *         operation. There is no load/limit/compare-and-swap loop - the buf_index
+ *         is a free running counter (RTE_WRITE_POSITION = 1) and the reserved index
+ *         is limited to the buffer size afterwards. The reservation time is thus
+ *         constant even if the logging functions are interrupted by other tasks or
+ *         interrupts that also log messages. Refer to the Readme.md file for more
+ *         details. The compiler must be C11 compatible or newer.
+ *
+ * @note   Requires a power of 2 buffer size and RTE_WRITE_POSITION = 1.
+ *         Single-shot logging is not supported because the reservation cannot
+ *         be undone if the message does not fit into the buffer.
+ *         A message that starts near the end of the buffer is written into the
+ *         four-word trailer - the same as with the other drivers.
+ ******************************************************************************/
+
+#ifndef RTEDBG_GENERIC_ATOMIC_FETCH_ADD_H
+#define RTEDBG_GENERIC_ATOMIC_FETCH_ADD_H
+
+#include "stdatomic.h"
+
+#if RTE_WRITE_POSITION == 0
+#error "The rtedbg_generic_atomic_fetch_add.h driver requires RTE_WRITE_POSITION = 1."
+#endif
+
+#if RTE_SINGLE_SHOT_ENABLED != 0
+#error "Single-shot logging is not supported by the rtedbg_generic_atomic_fetch_add.h driver."
+#endif
+
+#define RTE_RESERVE_SPACE(ptr, index, size)                                   \
+do                                                                            \
+{                                                                             \
+    RTE_RES_STATS_START()                                                     \
+    RTE_RES_STATS_PASS()                                                      \
+    index = atomic_fetch_add_explicit((_Atomic uint32_t *)&ptr->buf_index,    \
+                                      (uint32_t)(size), memory_order_relaxed);\
+    RTE_LIMIT_INDEX(index)                                                    \
+    RTE_RES_STATS_END()                                                       \
+} while(0)
+
+#endif  // RTEDBG_GENERIC_ATOMIC_FETCH_ADD_H
+
+/*==== End of file ====*/
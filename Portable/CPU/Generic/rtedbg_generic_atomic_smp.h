@@ -46,15 +46,20 @@
 #define RTE_RESERVE_SPACE(ptr, index, size)                                   \
 do                                                                            \
 {                                                                             \
+    RTE_RES_STATS_START()                                                     \
     _Atomic uint32_t *buff_idx = (_Atomic uint32_t *)&ptr->buf_index;         \
     uint32_t temp;                                                            \
     do                                                                        \
     {                                                                         \
+        RTE_RES_STATS_PASS()                                                  \
         temp = atomic_load(buff_idx);                                         \
         index = temp;                                                         \
         RTE_LIMIT_INDEX(index)                                                \
+        RTE_STREAM_CHECK_SPACE(ptr, index, size, (void)0)                     \
     }                                                                         \
-    while (!atomic_compare_exchange_weak(buff_idx, &temp, index + (size)));   \
+    while (!atomic_compare_exchange_weak(buff_idx, &temp,                     \
+                                         RTE_NEXT_INDEX(temp, index, size))); \
+    RTE_RES_STATS_END()                                                       \
     atomic_thread_fence(memory_order_release);                                \
 } while(0)
 
@@ -67,10 +72,12 @@ do                                                                            \
 
 #define RTE_RESERVE_SPACE(ptr, index, size)                                   \
 do {                                                                          \
+    RTE_RES_STATS_START()                                                     \
     _Atomic uint32_t *buff_idx = (_Atomic uint32_t *)&ptr->buf_index;         \
     uint32_t temp;                                                            \
     do                                                                        \
     {                                                                         \
+        RTE_RES_STATS_PASS()                                                  \
         temp = atomic_load(buff_idx);                                         \
         index = temp;                                                         \
         if (ptr->rte_cfg & RTE_SINGLE_SHOT_LOGGING_IS_ACTIVE)                 \
@@ -78,13 +85,15 @@ do {                                                                          \
             /* Check if there is enough space for the complete message */     \
             if ((index + (size)) >= (uint32_t)(RTE_BUFFER_SIZE))              \
             {                                                                 \
-                RTE_STOP_MESSAGE_LOGGING();                                   \
+                RTE_STOP_MESSAGE_LOGGING(ptr);                                \
                 return;           /* Exit the __rte_msg() function. */        \
             }                                                                 \
         }                                                                     \
         RTE_LIMIT_INDEX(index)                                                \
     }                                                                         \
-    while (!atomic_compare_exchange_weak(buff_idx, &temp, index + (size)));   \
+    while (!atomic_compare_exchange_weak(buff_idx, &temp,                     \
+                                         RTE_NEXT_INDEX(temp, index, size))); \
+    RTE_RES_STATS_END()                                                       \
     atomic_thread_fence(memory_order_release);                                \
 } while(0)
 
@@ -47,10 +47,15 @@
  */
 #define RTE_RESERVE_SPACE(ptr, buf_idx, size)                        \
 do {                                                                 \
+    RTE_RES_STATS_START()                                            \
     RTE_ENTER_CRITICAL()                                             \
-    buf_idx = ptr->buf_index;                                        \
+    RTE_RES_STATS_PASS()                                             \
+    const uint32_t rte_raw_index = ptr->buf_index;                   \
+    buf_idx = rte_raw_index;                                         \
     RTE_LIMIT_INDEX(buf_idx)                                         \
-    ptr->buf_index = buf_idx + (size);                               \
+    RTE_STREAM_CHECK_SPACE(ptr, buf_idx, size, RTE_EXIT_CRITICAL())  \
+    ptr->buf_index = RTE_NEXT_INDEX(rte_raw_index, buf_idx, size);   \
+    RTE_RES_STATS_END()                                              \
     RTE_EXIT_CRITICAL()                                              \
 } while(0)
 
@@ -62,20 +67,24 @@ do {                                                                 \
  */
 #define RTE_RESERVE_SPACE(ptr, buf_idx, size)                        \
 do {                                                                 \
+    RTE_RES_STATS_START()                                            \
     RTE_ENTER_CRITICAL()                                             \
-    buf_idx = ptr->buf_index;                                        \
+    RTE_RES_STATS_PASS()                                             \
+    const uint32_t rte_raw_index = ptr->buf_index;                   \
+    buf_idx = rte_raw_index;                                         \
     if (ptr->rte_cfg & RTE_SINGLE_SHOT_LOGGING_IS_ACTIVE)            \
     {                                                                \
         /* Check if there is enough space for the complete message */\
         if ((buf_idx + (size)) >= (uint32_t)(RTE_BUFFER_SIZE))       \
         {                                                            \
-            RTE_STOP_MESSAGE_LOGGING();                              \
+            RTE_STOP_MESSAGE_LOGGING(ptr);                           \
             RTE_EXIT_CRITICAL()                                      \
             return;        /* Exit the __rte_msg?() function. */     \
         }                                                            \
     }                                                                \
     RTE_LIMIT_INDEX(buf_idx)                                         \
-    ptr->buf_index = buf_idx + (size);                               \
+    ptr->buf_index = RTE_NEXT_INDEX(rte_raw_index, buf_idx, size);   \
+    RTE_RES_STATS_END()                                              \
     RTE_EXIT_CRITICAL()                                              \
 } while(0)
 #endif /* RTE_SINGLE_SHOT_ENABLED == 0 */
@@ -22,10 +22,15 @@
 /* Post-mortem and streaming debugging modes are possible. The code
  * is faster and smaller compared to the single-shot enabled version.
  */
-#define RTE_RESERVE_SPACE(ptr, buf_idx, size)   \
-    buf_idx = ptr->buf_index;                   \
-    RTE_LIMIT_INDEX(buf_idx)                    \
-    ptr->buf_index = buf_idx + (size);
+#define RTE_RESERVE_SPACE(ptr, buf_idx, size)                        \
+    RTE_RES_STATS_START()                                            \
+    RTE_RES_STATS_PASS()                                             \
+    const uint32_t rte_raw_index = ptr->buf_index;                   \
+    buf_idx = rte_raw_index;                                         \
+    RTE_LIMIT_INDEX(buf_idx)                                         \
+    RTE_STREAM_CHECK_SPACE(ptr, buf_idx, size, (void)0)              \
+    ptr->buf_index = RTE_NEXT_INDEX(rte_raw_index, buf_idx, size);   \
+    RTE_RES_STATS_END()
 
 #else   /* RTE_SINGLE_SHOT_ENABLED == 1 */
 
@@ -34,18 +39,22 @@
  * enabled by calling the function rte_init() with the appropriate parameter.
  */
 #define RTE_RESERVE_SPACE(ptr, buf_idx, size)                        \
-    buf_idx = ptr->buf_index;                                        \
+    RTE_RES_STATS_START()                                            \
+    RTE_RES_STATS_PASS()                                             \
+    const uint32_t rte_raw_index = ptr->buf_index;                   \
+    buf_idx = rte_raw_index;                                         \
     if (ptr->rte_cfg & RTE_SINGLE_SHOT_LOGGING_IS_ACTIVE)            \
     {                                                                \
         /* Check if there is enough space for the complete message */\
         if ((buf_idx + (size)) >= (uint32_t)(RTE_BUFFER_SIZE))       \
         {                                                            \
-            RTE_STOP_MESSAGE_LOGGING();                              \
+            RTE_STOP_MESSAGE_LOGGING(ptr);                           \
             return;        /* Exit the __rte_msg?() function. */     \
         }                                                            \
     }                                                                \
     RTE_LIMIT_INDEX(buf_idx)                                         \
-    ptr->buf_index = buf_idx + (size);
+    ptr->buf_index = RTE_NEXT_INDEX(rte_raw_index, buf_idx, size);   \
+    RTE_RES_STATS_END()
 #endif /* RTE_SINGLE_SHOT_ENABLED == 0 */
 
 #endif  // RTEDBG_GENERIC_NON_REENTRANT_H
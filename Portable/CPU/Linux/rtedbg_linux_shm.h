@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2024 Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rtedbg_linux_shm.h
+ * @author  Branko Premzel
+ * @version RTEdbg library <DEVELOPMENT BRANCH>
+ *
+ * @brief  Data logging structure in a POSIX shared memory object (RTE_SHARED_RTEDBG
+ *         = 1). Several processes can log to the same circular buffer and an external
+ *         data collector process can read (snapshot or stream) the data directly from
+ *         the shared memory - without copying the data and without system calls in
+ *         the processes that log the data. Include this file in the source file that
+ *         initializes the data logging, for example:
+ *            if (rte_linux_shm_attach("/rtedbg") == 0)
+ *            {
+ *                rte_init(RTE_ENABLE_ALL_FILTERS, RTE_CONTINUE_LOGGING);
+ *            }
+ *         A new shared memory object is filled with zeros, so the first rte_init() call
+ *         initializes it. The rte_init() calls of the other processes with the
+ *         RTE_CONTINUE_LOGGING parameter do not erase the data already logged.
+ *         All processes must use the same RTEdbg configuration.
+ *
+ * @note   The collector can map the object read-only (shm_open() with O_RDONLY,
+ *         mmap() with PROT_READ). The header size is defined in the rte_cfg word and
+ *         the buffer size in the buffer_size word of the header.
+ *
+ * @note   Use the rtedbg_linux_smp.h buffer space reservation driver and the
+ *         rtedbg_timer_linux.h timestamp driver, so that all processes have the
+ *         same time base. Link the application with -lrt if the C library does
+ *         not contain the shm_open() function (glibc older than 2.34).
+ *
+ * @note   The shm_open() and ftruncate() functions are declared only if the POSIX
+ *         functions are enabled - e.g. with the -std=gnu11 or -D_POSIX_C_SOURCE=200809L
+ *         compiler option. The macro cannot be defined in this file, because the
+ *         system header files are already included by rtedbg.h.
+ ******************************************************************************/
+
+#ifndef RTEDBG_LINUX_SHM_H
+#define RTEDBG_LINUX_SHM_H
+
+#include "rtedbg.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if RTE_SHARED_RTEDBG == 0
+#error "The rtedbg_linux_shm.h requires RTE_SHARED_RTEDBG = 1."
+#endif
+
+
+/*********************************************************************************
+ * @brief Map the shared memory object and use it for the data logging structure.
+ *        The object is created if it does not exist yet.
+ *
+ * @param  name  Name of the shared memory object - e.g. "/rtedbg" (see shm_open())
+ *
+ * @return 0 - OK, -1 - error (see errno). The size of an existing object does not
+ *         match the data logging structure size if errno = EINVAL.
+ *
+ * @note   Call the function before rte_init() and before any of the threads starts
+ *         logging messages.
+ *********************************************************************************/
+
+static inline int rte_linux_shm_attach(const char * const name)
+{
+    const size_t size = (size_t)rte_rtedbg_size();
+    const int fd = shm_open(name, O_RDWR | O_CREAT, 0660);
+    if (fd < 0)
+    {
+        return -1;
+    }
+
+    struct stat shm_stat;
+    int result = fstat(fd, &shm_stat);
+    if ((result == 0) && (shm_stat.st_size == 0))
+    {
+        result = ftruncate(fd, (off_t)size);        // New object
+    }
+    else if ((result == 0) && (shm_stat.st_size != (off_t)size))
+    {
+        errno = EINVAL;     // Created by a process with a different configuration
+        result = -1;
+    }
+
+    void *address = MAP_FAILED;
+    if (result == 0)
+    {
+        address = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    (void)close(fd);
+
+    if (address == MAP_FAILED)
+    {
+        return -1;
+    }
+
+    rte_set_rtedbg(address);
+    return 0;
+}
+
+#endif  // RTEDBG_LINUX_SHM_H
+
+/*==== End of file ====*/
@@ -0,0 +1,48 @@
+/*
+ * Copyright (c) 2024 Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rtedbg_linux_smp.h
+ * @author  Branko Premzel
+ * @version RTEdbg library <DEVELOPMENT BRANCH>
+ *
+ * @brief  Buffer space reservation for Linux (and other POSIX) user space
+ *         applications. Any number of threads - and processes if the data logging
+ *         structure is in shared memory (see RTE_SHARED_RTEDBG) - running on any of
+ *         the CPU cores can log to the same circular buffer. No system calls or
+ *         locks are used - the space is reserved with C11 atomic operations:
+ *         - atomic_fetch_add() (wait-free) if the write position is free running
+ *           (RTE_WRITE_POSITION = 1) and single-shot logging is disabled - see
+ *           rtedbg_generic_atomic_fetch_add.h,
+ *         - a compare-and-swap loop otherwise - see rtedbg_generic_atomic_smp.h.
+ *         Add the Portable/CPU/Generic folder to the include path.
+ *
+ * @note   The atomic operations must be lock-free. Otherwise they would not work
+ *         between processes and a thread preempted while holding the lock would
+ *         block the others.
+ *
+ * @note   Define the memory barrier in the rtedbg_config.h, for example:
+ *            #define RTE_DATA_MEMORY_BARRIER()  atomic_thread_fence(memory_order_seq_cst)
+ ******************************************************************************/
+
+#ifndef RTEDBG_LINUX_SMP_H
+#define RTEDBG_LINUX_SMP_H
+
+#include <stdatomic.h>
+
+#if ATOMIC_INT_LOCK_FREE != 2
+#error "The rtedbg_linux_smp.h driver requires lock-free 32-bit atomic operations."
+#endif
+
+#if (RTE_WRITE_POSITION != 0) && (RTE_SINGLE_SHOT_ENABLED == 0)
+#include "rtedbg_generic_atomic_fetch_add.h"
+#else
+#include "rtedbg_generic_atomic_smp.h"
+#endif
+
+#endif  // RTEDBG_LINUX_SMP_H
+
+/*==== End of file ====*/
@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2024 Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rtedbg_riscv_amo.h
+ * @author  Branko Premzel
+ * @version RTEdbg library <DEVELOPMENT BRANCH>
+ *
+ * @brief  RISC-V core-specific functions for buffer space reservation.
+ *         This version is for RISC-V cores with the A (atomic) extension
+ *         (e.g. RV32IMAC). Use 'rtedbg_generic_irq_disable.h' for cores without it.
+ *         The space is reserved with the LR.W/SC.W instructions. If the buffer
+ *         index is free running (RTE_WRITE_POSITION = 1) and single-shot logging
+ *         is disabled, a single AMOADD.W instruction is used instead - the
+ *         reservation then takes a constant time.
+ *
+ * @note   The code between the LR.W and SC.W instructions has no memory accesses, so
+ *         the loop is a constrained LR/SC sequence with the forward progress guarantee
+ *         of the RISC-V specification. With streaming enabled, the read index is
+ *         loaded before the LR.W instruction (again in every pass of the loop). The
+ *         rd_index value can then be slightly out of date - the reader only frees
+ *         space, so a message can only be discarded too early and never overwrite
+ *         the unread data.
+ *
+ * @note   This driver version is suitable for single-core devices or multi-core
+ *         devices where data logging is performed for only one core or separately
+ *         for each core (see RTE_SMP_CORES in the rtedbg_config_template.h).
+ *         Use the generic symmetric multi-core device driver "rtedbg_generic_atomic_smp.h"
+ *         if you plan to use a common g_rtedbg data logging structure for all CPU cores.
+ *
+ * @note   The trap handlers (e.g. the RTOS context switch) must invalidate the
+ *         LR.W reservation - usually with a dummy SC.W instruction - as required
+ *         by the RISC-V specification.
+ *
+ * @note   RTE_RESERVE_SPACE is defined as a macro instead of an inline function
+ *         because the compiler typically generates smaller code when single-shot
+ *         logging is enabled.
+ ******************************************************************************/
+
+#ifndef RTEDBG_RISCV_AMO_H
+#define RTEDBG_RISCV_AMO_H
+
+#if !defined __riscv_atomic
+#error "The rtedbg_riscv_amo.h driver requires a RISC-V core with the A (atomic) extension."
+#endif
+
+/***
+ * @brief Load-reserved word.
+ */
+__STATIC_FORCEINLINE uint32_t rte_riscv_lr_w(volatile uint32_t *address)
+{
+    uint32_t value;
+    __asm volatile ("lr.w %0, (%1)" : "=r" (value) : "r" (address) : "memory");
+    return value;
+}
+
+
+/***
+ * @brief Store-conditional word.
+ *
+ * @return 0 - the value has been stored, otherwise the reservation has been lost.
+ */
+__STATIC_FORCEINLINE uint32_t rte_riscv_sc_w(const uint32_t value, volatile uint32_t *address)
+{
+    uint32_t result;
+    __asm volatile ("sc.w %0, %2, (%1)" : "=&r" (result) : "r" (address), "r" (value) : "memory");
+    return result;
+}
+
+
+#if (RTE_STREAMING_ENABLED != 0)
+#define RTE_RISCV_RD_INDEX(ptr)  (ptr->rd_index)
+#else
+#define RTE_RISCV_RD_INDEX(ptr)  0U
+#endif
+
+
+#if (RTE_WRITE_POSITION != 0) && (RTE_SINGLE_SHOT_ENABLED == 0)
+
+/***
+ * @brief Atomic add word.
+ *
+ * @return Value of the memory word before the addition.
+ */
+__STATIC_FORCEINLINE uint32_t rte_riscv_amoadd_w(volatile uint32_t *address, const uint32_t value)
+{
+    uint32_t old_value;
+    __asm volatile ("amoadd.w %0, %2, (%1)" : "=r" (old_value) : "r" (address), "r" (value) : "memory");
+    return old_value;
+}
+
+/* Free running index: the space is reserved with a single instruction and the index
+ * is limited to the buffer size afterwards (see rtedbg_generic_atomic_fetch_add.h).
+ */
+#define RTE_RESERVE_SPACE(ptr, buf_idx, size)                               \
+do {                                                                        \
+    RTE_RES_STATS_START()                                                   \
+    RTE_RES_STATS_PASS()                                                    \
+    buf_idx = rte_riscv_amoadd_w(&ptr->buf_index, (uint32_t)(size));        \
+    RTE_LIMIT_INDEX(buf_idx)                                                \
+    RTE_RES_STATS_END()                                                     \
+} while(0)
+
+#elif RTE_SINGLE_SHOT_ENABLED == 0
+
+/* Post-mortem and streaming mode debugging are possible. The code is
+ * faster and smaller compared to the single-shot enabled version.
+ */
+#define RTE_RESERVE_SPACE(ptr, buf_idx, size)                               \
+do {                                                                        \
+    RTE_RES_STATS_START()                                                   \
+    uint32_t rte_raw_index;                                                 \
+    uint32_t new_index;                                                     \
+    do                                                                      \
+    {                                                                       \
+        RTE_RES_STATS_PASS()                                                \
+        const uint32_t rte_rd_index = RTE_RISCV_RD_INDEX(ptr);              \
+        (void)rte_rd_index;                                                 \
+        rte_raw_index = rte_riscv_lr_w(&ptr->buf_index);                    \
+        buf_idx = rte_raw_index;                                            \
+        RTE_LIMIT_INDEX(buf_idx)                                            \
+        RTE_STREAM_CHECK_SPACE_RD(ptr, buf_idx, rte_rd_index, size, (void)0) \
+        new_index = RTE_NEXT_INDEX(rte_raw_index, buf_idx, size);           \
+    }                                                                       \
+    while (rte_riscv_sc_w(new_index, &ptr->buf_index) != 0U);               \
+    RTE_RES_STATS_END()                                                     \
+} while(0)
+
+#else   /* RTE_SINGLE_SHOT_ENABLED == 1 */
+
+/* Single-shot and post-mortem/streaming data logging are possible.
+ * Post-mortem logging is the default mode. Single-shot logging must be
+ * enabled by calling the function rte_init() with the appropriate parameter.
+ * The rte_cfg word is read before the LR.W instruction, so that there is no
+ * additional load between the LR.W and SC.W instructions.
+ */
+#define RTE_RESERVE_SPACE(ptr, buf_idx, size)                               \
+do {                                                                        \
+    RTE_RES_STATS_START()                                                   \
+    const uint32_t rte_single_shot =                                        \
+        ptr->rte_cfg & RTE_SINGLE_SHOT_LOGGING_IS_ACTIVE;                   \
+    uint32_t rte_raw_index;                                                 \
+    uint32_t new_index;                                                     \
+    do                                                                      \
+    {                                                                       \
+        RTE_RES_STATS_PASS()                                                \
+        rte_raw_index = rte_riscv_lr_w(&ptr->buf_index);                    \
+        buf_idx = rte_raw_index;                                            \
+        if (rte_single_shot != 0U)                                          \
+        {                                                                   \
+            /* Check if there is enough space for the complete message */   \
+            if ((buf_idx + (size)) >= (uint32_t)(RTE_BUFFER_SIZE))          \
+            {                                                               \
+               RTE_STOP_MESSAGE_LOGGING(ptr);                               \
+               return;           /* Exit the __rte_msg function. */         \
+            }                                                               \
+        }                                                                   \
+        RTE_LIMIT_INDEX(buf_idx)                                            \
+        new_index = RTE_NEXT_INDEX(rte_raw_index, buf_idx, size);           \
+    }                                                                       \
+    while (rte_riscv_sc_w(new_index, &ptr->buf_index) != 0U);               \
+    RTE_RES_STATS_END()                                                     \
+} while(0)
+
+#endif /* RTE_SINGLE_SHOT_ENABLED == 0 */
+
+#endif  // RTEDBG_RISCV_AMO_H
+
+/*==== End of file ====*/
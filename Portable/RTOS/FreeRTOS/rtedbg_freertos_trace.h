@@ -0,0 +1,93 @@
+/*
+ * Copyright (c) 2024 Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rtedbg_freertos_trace.h
+ * @author  Branko Premzel
+ * @brief   FreeRTOS trace hooks - the context switches, task state changes and
+ *          interrupts are logged as one-word RTEdbg messages (see rtedbg_rtos_trace.h).
+ *          Include this file at the end of the FreeRTOSConfig.h:
+ *              #define configUSE_TRACE_FACILITY           1
+ *              #define INCLUDE_xTaskGetCurrentTaskHandle  1
+ *              #include "rtedbg_freertos_trace.h"
+ *          The task number is the uxTCBNumber assigned by the kernel when the task is
+ *          created (1, 2, 3, ...). The number and name of each task are logged when
+ *          the task is created. Call rte_init() before the tasks are created.
+ *
+ *          The following events are logged:
+ *          - traceTASK_SWITCHED_IN            - task switched in (scheduling timeline)
+ *          - traceMOVED_TASK_TO_READY_STATE   - task ready (e.g. unblocked by a queue)
+ *          - traceBLOCKING_ON_QUEUE_xxx       - task blocked on a queue, semaphore or mutex
+ *          - traceTASK_DELAY, traceTASK_DELAY_UNTIL - task blocked by a delay
+ *
+ *          FreeRTOS has no interrupt hooks. Add the following to the interrupt
+ *          service routines that should be shown in the timeline:
+ *              RTE_TRACE_ISR_ENTER(isr_number);  // e.g. __get_IPSR() on Cortex-M
+ *              ...
+ *              RTE_TRACE_ISR_EXIT();
+ *
+ * @note    Define any of the hooks before including this file to replace it
+ *          with a different version or with an empty macro.
+ *
+ * @version RTEdbg library <DEVELOPMENT BRANCH>
+ ******************************************************************************/
+
+#ifndef RTEDBG_FREERTOS_TRACE_H
+#define RTEDBG_FREERTOS_TRACE_H
+
+// The FreeRTOSConfig.h is included also in the assembler files of some ports.
+#if !defined __ASSEMBLER__ && !defined __IAR_SYSTEMS_ASM__
+
+#include "rtedbg_rtos_trace.h"
+
+#if !defined configUSE_TRACE_FACILITY || (configUSE_TRACE_FACILITY == 0)
+#error "The configUSE_TRACE_FACILITY must be set to 1 (the task numbers are used for the trace)."
+#endif
+
+#if !defined traceTASK_CREATE
+#define traceTASK_CREATE(pxNewTCB)                                                  \
+    RTE_TRACE_TASK_CREATE((pxNewTCB)->uxTCBNumber, (pxNewTCB)->pcTaskName)
+#endif
+
+#if !defined traceTASK_SWITCHED_IN
+#define traceTASK_SWITCHED_IN()             RTE_TRACE_TASK_IN(pxCurrentTCB->uxTCBNumber)
+#endif
+
+#if !defined traceMOVED_TASK_TO_READY_STATE
+#define traceMOVED_TASK_TO_READY_STATE(pxTCB)  RTE_TRACE_TASK_READY((pxTCB)->uxTCBNumber)
+#endif
+
+/* The queue hooks are executed in queue.c, where the pxCurrentTCB is not visible.
+ * The number of the current task is read with the kernel functions there.
+ */
+#if !defined traceBLOCKING_ON_QUEUE_RECEIVE
+#define traceBLOCKING_ON_QUEUE_RECEIVE(pxQueue)                                     \
+    RTE_TRACE_TASK_BLOCK(uxTaskGetTaskNumber(xTaskGetCurrentTaskHandle()))
+#endif
+
+#if !defined traceBLOCKING_ON_QUEUE_PEEK
+#define traceBLOCKING_ON_QUEUE_PEEK(pxQueue)                                        \
+    RTE_TRACE_TASK_BLOCK(uxTaskGetTaskNumber(xTaskGetCurrentTaskHandle()))
+#endif
+
+#if !defined traceBLOCKING_ON_QUEUE_SEND
+#define traceBLOCKING_ON_QUEUE_SEND(pxQueue)                                        \
+    RTE_TRACE_TASK_BLOCK(uxTaskGetTaskNumber(xTaskGetCurrentTaskHandle()))
+#endif
+
+#if !defined traceTASK_DELAY
+#define traceTASK_DELAY()                   RTE_TRACE_TASK_BLOCK(pxCurrentTCB->uxTCBNumber)
+#endif
+
+#if !defined traceTASK_DELAY_UNTIL
+#define traceTASK_DELAY_UNTIL(xTimeToWake)  RTE_TRACE_TASK_BLOCK(pxCurrentTCB->uxTCBNumber)
+#endif
+
+#endif  // !defined __ASSEMBLER__ && !defined __IAR_SYSTEMS_ASM__
+
+#endif  // RTEDBG_FREERTOS_TRACE_H
+
+/*==== End of file ====*/
@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2024 Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rtedbg_zephyr_trace.c
+ * @author  Branko Premzel
+ * @brief   Zephyr tracing backend - the context switches, thread state changes and
+ *          interrupts are logged as one-word RTEdbg messages (see rtedbg_rtos_trace.h).
+ *          The file implements the user-defined tracing hooks of the kernel.
+ *          Add it to the application and enable the following in the prj.conf:
+ *              CONFIG_TRACING=y
+ *              CONFIG_TRACING_USER=y
+ *              CONFIG_THREAD_CUSTOM_DATA=y
+ *          Each thread gets a number (1, 2, 3, ...) when it is created. The number is
+ *          stored in the custom_data field of the thread. The thread names are logged
+ *          when they are set (CONFIG_THREAD_NAME=y).
+ *          Call rte_init() as early as possible - e.g. from a SYS_INIT() function with
+ *          the PRE_KERNEL_1 level - to log the numbers of the kernel threads.
+ *
+ * @note    Define RTE_TRACE_ISR_NUMBER() in the rtedbg_config.h to log the number of
+ *          the active interrupt with the ISR enter event. The IPSR register is used
+ *          on Cortex-M cores by default.
+ *
+ * @version RTEdbg library <DEVELOPMENT BRANCH>
+ ******************************************************************************/
+
+#include <zephyr/kernel.h>
+#include <zephyr/sys/atomic.h>
+#include "rtedbg_rtos_trace.h"
+
+#if !defined CONFIG_TRACING_USER
+#error "The CONFIG_TRACING_USER must be enabled for the RTEdbg tracing backend."
+#endif
+
+#if !defined CONFIG_THREAD_CUSTOM_DATA
+#error "The CONFIG_THREAD_CUSTOM_DATA must be enabled (it contains the thread number)."
+#endif
+
+#if !defined RTE_TRACE_ISR_NUMBER
+#if defined CONFIG_CPU_CORTEX_M
+#include <cmsis_core.h>
+#define RTE_TRACE_ISR_NUMBER()  __get_IPSR()
+#else
+#define RTE_TRACE_ISR_NUMBER()  0U
+#endif
+#endif
+
+static atomic_t rte_thread_count;   //!< Number of the last created thread
+
+
+/***
+ * @brief Get the number of the thread assigned by sys_trace_thread_create_user().
+ */
+
+static inline uint32_t rte_thread_number(const struct k_thread * const thread)
+{
+    return (uint32_t)(uintptr_t)thread->custom_data;
+}
+
+
+void sys_trace_thread_create_user(struct k_thread *thread)
+{
+    const uint32_t number = (uint32_t)atomic_inc(&rte_thread_count) + 1U;
+    thread->custom_data = (void *)(uintptr_t)number;
+    RTE_TRACE_TASK_CREATE(number, "");
+}
+
+
+void sys_trace_thread_name_set_user(struct k_thread *thread)
+{
+    const char *name = k_thread_name_get(thread);
+    RTE_TRACE_TASK_CREATE(rte_thread_number(thread), (name != NULL) ? name : "");
+}
+
+
+void sys_trace_thread_switched_in_user(void)
+{
+    RTE_TRACE_TASK_IN(rte_thread_number(k_current_get()));
+}
+
+
+void sys_trace_thread_sched_ready_user(struct k_thread *thread)
+{
+    RTE_TRACE_TASK_READY(rte_thread_number(thread));
+}
+
+
+void sys_trace_thread_pend_user(struct k_thread *thread)
+{
+    RTE_TRACE_TASK_BLOCK(rte_thread_number(thread));
+}
+
+
+void sys_trace_isr_enter_user(int nested_interrupts)
+{
+    ARG_UNUSED(nested_interrupts);
+    RTE_TRACE_ISR_ENTER(RTE_TRACE_ISR_NUMBER());
+}
+
+
+void sys_trace_isr_exit_user(int nested_interrupts)
+{
+    ARG_UNUSED(nested_interrupts);
+    RTE_TRACE_ISR_EXIT();
+}
+
+/*==== End of file ====*/
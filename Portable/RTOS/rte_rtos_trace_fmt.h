@@ -0,0 +1,18 @@
+#ifndef RTE_RTE_RTOS_TRACE_FMT_H
+#define RTE_RTE_RTOS_TRACE_FMT_H
+/* "rte_rtos_trace_fmt.h" - Format definitions for the RTOS scheduler trace (rtedbg_rtos_trace.h) */
+/* Add INCLUDE("rte_rtos_trace_fmt.h") to the rte_main_fmt.h of the project.                    */
+
+// FILTER(F_RTOS, "RTOS scheduler events")
+
+/* One-word events - the task number (or interrupt number) is the extended data (5 bits) */
+// EXT_MSG0_5_RTOS_TASK_IN "Task switched in"
+// EXT_MSG0_5_RTOS_TASK_READY "Task ready"
+// EXT_MSG0_5_RTOS_TASK_BLOCK "Task blocked"
+// EXT_MSG0_5_RTOS_ISR_ENTER "ISR enter"
+// MSG0_RTOS_ISR_EXIT "ISR exit"
+
+/* Task number and name - logged once when the task is created */
+// MSG1_RTOS_TASK_CREATE "\nTask %u created"
+// MSGN_RTOS_TASK_NAME " name: %s"
+#endif
@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024 Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rtedbg_rtos_trace.h
+ * @author  Branko Premzel
+ * @brief   RTOS scheduler events logged as one-word messages (__rte_msg0()).
+ *          The task number is part of the format ID (extended data, 5 bits), so
+ *          each event is logged with only one word - the timestamp and the format ID.
+ *          All events use the F_RTOS filter group and can be enabled or disabled
+ *          together. The macros are used by the RTOS specific trace hooks:
+ *          - FreeRTOS: rtedbg_freertos_trace.h
+ *          - Zephyr:   rtedbg_zephyr_trace.c
+ *
+ * @note    Task numbers above 31 share the format IDs with the lower ones (only the
+ *          low five bits are logged). Change the macros below to RTE_EXT_MSG0_6 ...
+ *          RTE_EXT_MSG0_8 and the format names in the rte_rtos_trace_fmt.h if the
+ *          application has more tasks or interrupt sources.
+ *
+ * @version RTEdbg library <DEVELOPMENT BRANCH>
+ ******************************************************************************/
+
+#ifndef RTEDBG_RTOS_TRACE_H
+#define RTEDBG_RTOS_TRACE_H
+
+#include "rtedbg.h"
+#include "rte_rtos_trace_fmt.h"     // RTOS trace filter and format ID definitions
+
+#define RTE_TRACE_TASK_IN(task_number)                                              \
+    RTE_EXT_MSG0_5(EXT_MSG0_5_RTOS_TASK_IN, F_RTOS, (uint32_t)(task_number))
+
+#define RTE_TRACE_TASK_READY(task_number)                                           \
+    RTE_EXT_MSG0_5(EXT_MSG0_5_RTOS_TASK_READY, F_RTOS, (uint32_t)(task_number))
+
+#define RTE_TRACE_TASK_BLOCK(task_number)                                           \
+    RTE_EXT_MSG0_5(EXT_MSG0_5_RTOS_TASK_BLOCK, F_RTOS, (uint32_t)(task_number))
+
+#define RTE_TRACE_ISR_ENTER(isr_number)                                             \
+    RTE_EXT_MSG0_5(EXT_MSG0_5_RTOS_ISR_ENTER, F_RTOS, (uint32_t)(isr_number))
+
+#define RTE_TRACE_ISR_EXIT()                                                        \
+    RTE_MSG0(MSG0_RTOS_ISR_EXIT, F_RTOS)
+
+// Log the task number and name - the host can assign the names to the task numbers.
+#define RTE_TRACE_TASK_CREATE(task_number, task_name)                               \
+{                                                                                   \
+    RTE_MSG1(MSG1_RTOS_TASK_CREATE, F_RTOS, (uint32_t)(task_number));               \
+    RTE_STRING(MSGN_RTOS_TASK_NAME, F_RTOS, (task_name));                           \
+}
+
+#endif  // RTEDBG_RTOS_TRACE_H
+
+/*==== End of file ====*/
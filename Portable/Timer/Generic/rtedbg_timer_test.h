@@ -11,6 +11,9 @@
  *          or with new compilers. It counts logged messages, not time.
  *          The timestamp value included in the messages is reproducible and
  *          does not depend on the specific hardware or compiler version/settings.
+ *          The driver can also be used to compile and test the library on a host
+ *          computer. The counter is not incremented atomically - the timestamps of
+ *          messages logged simultaneously from several threads may be the same.
  *
  * @version RTEdbg library v1.00.03
  **********************************************************************************/
@@ -36,7 +39,7 @@ struct _tstamp64
 } t_stamp;
 #endif // RTE_USE_LONG_TIMESTAMP != 0
 
-static uint32_t g_message_counter;
+uint32_t g_message_counter;     // Emulated timestamp counter
 
 
 /***
@@ -52,6 +55,8 @@ __STATIC_FORCEINLINE void rte_init_timestamp_counter(void)
     t_stamp.l = t_stamp.h = 0;
 #endif
 }
+#else
+extern uint32_t g_message_counter;  // Defined in the rtedbg.c (shared with the inline logging functions)
 #endif  // !defined RTE_USE_INLINE_FUNCTIONS
 
 
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2024 Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/**********************************************************************************
+ * @file    rtedbg_timer_linux.h
+ * @author  Branko Premzel
+ * @brief   Time measurement for data logging functions in Linux (and other POSIX)
+ *          user space applications. By default, the CLOCK_MONOTONIC clock is read
+ *          with clock_gettime() (no system call on most platforms - it is handled by
+ *          the vDSO). The timestamps are in nanoseconds:
+ *              #define RTE_GET_TSTAMP_FREQUENCY()  1000000000U
+ *
+ *          Define RTE_LINUX_USE_CPU_COUNTER in the rtedbg_config.h to read the CPU
+ *          counter directly - this is faster than the clock_gettime() call:
+ *          - x86 / x86-64: time stamp counter (RDTSC instruction). Define the TSC
+ *            frequency with RTE_GET_TSTAMP_FREQUENCY(). The CPU must have an
+ *            invariant TSC (constant_tsc and nonstop_tsc flags in /proc/cpuinfo).
+ *          - AArch64: virtual counter (CNTVCT_EL0). Its frequency can be read with
+ *              #define RTE_GET_TSTAMP_FREQUENCY()  rte_linux_counter_frequency()
+ *
+ * @note    The timers are shared by all processes and are not reset by rte_init().
+ *          All processes that log to the same shared memory structure thus have the
+ *          same time base. The counters have 64 bits - the rte_long_timestamp()
+ *          function reads all of them and is reentrant.
+ *
+ * @note    The clock_gettime() function is declared only if the POSIX functions are
+ *          enabled - e.g. with the -std=gnu11 or -D_POSIX_C_SOURCE=200809L
+ *          compiler option.
+ *
+ * @version RTEdbg library <DEVELOPMENT BRANCH>
+ **********************************************************************************/
+
+#ifndef RTEDBG_TIMER_LINUX_H_
+#define RTEDBG_TIMER_LINUX_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rtedbg.h"                      // Hardware and project-specific definitions
+
+#define RTE_TIMESTAMP_COUNTER_BITS  32U  // Number of timer counter bits available for the timestamp
+
+#if defined RTE_LINUX_USE_CPU_COUNTER
+#if defined __x86_64__ || defined __i386__
+#include <x86intrin.h>
+#elif !defined __aarch64__
+#error "RTE_LINUX_USE_CPU_COUNTER is only supported for x86, x86-64 and AArch64 CPU cores."
+#endif
+#else
+#include <time.h>
+#endif
+
+
+/***
+ * @brief Read the complete 64-bit timestamp counter.
+ *
+ * @return Current value of the counter.
+ */
+
+__STATIC_FORCEINLINE uint64_t rte_linux_counter(void)
+{
+#if !defined RTE_LINUX_USE_CPU_COUNTER
+    struct timespec time_now;
+    (void)clock_gettime(CLOCK_MONOTONIC, &time_now);
+    return ((uint64_t)time_now.tv_sec * 1000000000U) + (uint64_t)time_now.tv_nsec;
+#elif defined __aarch64__
+    uint64_t value;
+    __asm volatile ("mrs %0, cntvct_el0" : "=r" (value));
+    return value;
+#else
+    return (uint64_t)__rdtsc();
+#endif
+}
+
+
+/***
+ * @brief Get the frequency of the timestamp counter.
+ *
+ * @return Counter frequency [Hz] - 0 for the x86 time stamp counter (unknown).
+ */
+
+__STATIC_FORCEINLINE uint32_t rte_linux_counter_frequency(void)
+{
+#if !defined RTE_LINUX_USE_CPU_COUNTER
+    return 1000000000U;
+#elif defined __aarch64__
+    uint64_t frequency;
+    __asm volatile ("mrs %0, cntfrq_el0" : "=r" (frequency));
+    return (uint32_t)frequency;
+#else
+    return 0U;
+#endif
+}
+
+
+#if !defined RTE_USE_INLINE_FUNCTIONS
+
+/***
+ * @brief The counters cannot be reset - nothing to do.
+ */
+
+__STATIC_FORCEINLINE void rte_init_timestamp_counter(void)
+{
+}
+#endif  // !defined RTE_USE_INLINE_FUNCTIONS
+
+
+/***
+ * @brief Get the current value of the timestamp counter.
+ *
+ * @return Bottom 32 bits of the counter.
+ */
+
+__STATIC_FORCEINLINE uint32_t rte_get_timestamp(void)
+{
+    return (uint32_t)rte_linux_counter();
+}
+
+
+#if (RTE_USE_LONG_TIMESTAMP != 0) && (!defined RTE_USE_INLINE_FUNCTIONS)
+
+/*********************************************************************************
+ * @brief Writes a message with a long timestamp to the buffer.
+ *        The low bits of the timestamp are included in the message words with the
+ *        format ID. Only the higher 32 bits are transmitted in the message's
+ *        data part.
+ *
+ * @note  The complete 64-bit counter is read, so the function may be called from
+ *        any thread or process.
+ *********************************************************************************/
+
+RTE_OPTIM_SIZE void rte_long_timestamp(void)
+{
+    uint64_t timestamp_64 = rte_linux_counter();
+    uint32_t long_t_stamp = (uint32_t)(timestamp_64 >>
+                                       ((32U - ((uint32_t)(RTE_FMT_ID_BITS))) - 1U + (RTE_TIMESTAMP_SHIFT)));
+    RTE_MSG1(MSG1_LONG_TIMESTAMP, F_SYSTEM, long_t_stamp);
+}
+
+#endif // (RTE_USE_LONG_TIMESTAMP != 0) && (!defined RTE_USE_INLINE_FUNCTIONS)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RTEDBG_TIMER_LINUX_H_ */
+
+/*==== End of file ====*/
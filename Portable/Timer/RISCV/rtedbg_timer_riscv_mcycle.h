@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2024 Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/**********************************************************************************
+ * @file    rtedbg_timer_riscv_mcycle.h
+ * @author  Branko Premzel
+ * @brief   Time measurement for data logging functions using the mcycle CPU
+ *          cycle counter of RISC-V cores. The timestamp frequency is equal to the
+ *          CPU core clock - define RTE_GET_TSTAMP_FREQUENCY() accordingly.
+ *
+ * @note    The mcycle CSR is only accessible in machine mode. Define the macro
+ *          RTE_RISCV_USE_CYCLE_CSR in the rtedbg_config.h if the logging functions
+ *          are called in user or supervisor mode. The read-only 'cycle' CSR is used
+ *          then - the access must be enabled in the mcounteren (and scounteren)
+ *          registers and the counter is not reset by rte_init().
+ *
+ * @note    The counter is enabled by clearing the CY bit in the mcountinhibit CSR.
+ *          Define RTE_RISCV_NO_MCOUNTINHIBIT if the core does not implement it
+ *          (it was added with version 1.11 of the RISC-V privileged specification).
+ *
+ * @note    On many cores the cycle counter stops while the core is waiting for
+ *          an interrupt (WFI instruction). Use the rtedbg_timer_riscv_mtime.h
+ *          driver if sleep modes are used.
+ *
+ * @note    The counter has 64 bits. The rte_long_timestamp() function reads all
+ *          of them, so it does not have to track the counter overflows and it
+ *          is reentrant.
+ *
+ * @version RTEdbg library <DEVELOPMENT BRANCH>
+ **********************************************************************************/
+
+#ifndef RTEDBG_TIMER_RISCV_MCYCLE_H_
+#define RTEDBG_TIMER_RISCV_MCYCLE_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rtedbg.h"                      // Hardware and project-specific definitions
+
+#define RTE_TIMESTAMP_COUNTER_BITS  32U  // Number of timer counter bits available for the timestamp
+
+#if defined RTE_RISCV_USE_CYCLE_CSR
+#define RTE_RISCV_READ_CYCLE(value)    __asm volatile ("csrr %0, cycle" : "=r" (value))
+#define RTE_RISCV_READ_CYCLEH(value)   __asm volatile ("csrr %0, cycleh" : "=r" (value))
+#else
+#define RTE_RISCV_READ_CYCLE(value)    __asm volatile ("csrr %0, mcycle" : "=r" (value))
+#define RTE_RISCV_READ_CYCLEH(value)   __asm volatile ("csrr %0, mcycleh" : "=r" (value))
+#endif
+
+#if !defined RTE_USE_INLINE_FUNCTIONS
+
+/***
+ * @brief Initialize the cycle counter and reset it.
+ */
+
+__STATIC_FORCEINLINE void rte_init_timestamp_counter(void)
+{
+#if !defined RTE_RISCV_USE_CYCLE_CSR
+#if !defined RTE_RISCV_NO_MCOUNTINHIBIT
+    __asm volatile ("csrci 0x320, 1");          // mcountinhibit.CY = 0 - enable the counter
+#endif
+    __asm volatile ("csrw mcycle, zero");       // Reset the cycle counter
+#if __riscv_xlen == 32
+    __asm volatile ("csrw mcycleh, zero");
+#endif
+#endif // !defined RTE_RISCV_USE_CYCLE_CSR
+}
+#endif  // !defined RTE_USE_INLINE_FUNCTIONS
+
+
+/***
+ * @brief Get the current value of the timestamp counter.
+ *
+ * @return Bottom 32 bits of the cycle counter.
+ */
+
+__STATIC_FORCEINLINE uint32_t rte_get_timestamp(void)
+{
+    unsigned long value;
+    RTE_RISCV_READ_CYCLE(value);
+    return (uint32_t)value;
+}
+
+
+#if (RTE_USE_LONG_TIMESTAMP != 0) && (!defined RTE_USE_INLINE_FUNCTIONS)
+
+/*********************************************************************************
+ * @brief Writes a message with a long timestamp to the buffer.
+ *        The low bits of the timestamp are included in the message words with the
+ *        format ID. Only the higher 32 bits are transmitted in the message's
+ *        data part.
+ *
+ * @note  The complete 64-bit counter is read, so the function may be called from
+ *        any part of the program - e.g. from a timer interrupt routine.
+ *********************************************************************************/
+
+RTE_OPTIM_SIZE void rte_long_timestamp(void)
+{
+    uint64_t timestamp_64;
+#if __riscv_xlen == 32
+    uint32_t high;
+    uint32_t low;
+    uint32_t high2;
+
+    do          // Repeat if the bottom part overflowed between the two reads
+    {
+        RTE_RISCV_READ_CYCLEH(high);
+        RTE_RISCV_READ_CYCLE(low);
+        RTE_RISCV_READ_CYCLEH(high2);
+    }
+    while (high != high2);
+
+    timestamp_64 = (uint64_t)low | ((uint64_t)high << 32U);
+#else
+    unsigned long value;
+    RTE_RISCV_READ_CYCLE(value);
+    timestamp_64 = (uint64_t)value;
+#endif
+
+    uint32_t long_t_stamp = (uint32_t)(timestamp_64 >>
+                                       ((32U - ((uint32_t)(RTE_FMT_ID_BITS))) - 1U + (RTE_TIMESTAMP_SHIFT)));
+    RTE_MSG1(MSG1_LONG_TIMESTAMP, F_SYSTEM, long_t_stamp);
+}
+
+#endif // (RTE_USE_LONG_TIMESTAMP != 0) && (!defined RTE_USE_INLINE_FUNCTIONS)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RTEDBG_TIMER_RISCV_MCYCLE_H_ */
+
+/*==== End of file ====*/
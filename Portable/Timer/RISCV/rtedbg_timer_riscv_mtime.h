@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024 Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/**********************************************************************************
+ * @file    rtedbg_timer_riscv_mtime.h
+ * @author  Branko Premzel
+ * @brief   Time measurement for data logging functions using the RISC-V machine
+ *          timer (mtime register of the CLINT/ACLINT). The timer runs at a constant
+ *          frequency and also counts while the core is in a sleep mode.
+ *          Define the address of the mtime register and the timer frequency in
+ *          the rtedbg_config.h, for example:
+ *              #define RTE_RISCV_MTIME_ADDRESS    0x0200BFF8U
+ *              #define RTE_GET_TSTAMP_FREQUENCY() 32768U
+ *
+ * @note    The mtime timer is not reset by rte_init() because it is usually also
+ *          used by the RTOS (timer interrupt with the mtimecmp register). The first
+ *          timestamps therefore do not start with zero. Enable the long timestamps
+ *          if the absolute time is needed.
+ *
+ * @note    The timer frequency is usually much lower than the CPU clock frequency.
+ *          Several short messages may thus get the same timestamp value.
+ *
+ * @version RTEdbg library <DEVELOPMENT BRANCH>
+ **********************************************************************************/
+
+#ifndef RTEDBG_TIMER_RISCV_MTIME_H_
+#define RTEDBG_TIMER_RISCV_MTIME_H_
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "rtedbg.h"                      // Hardware and project-specific definitions
+
+#if !defined RTE_RISCV_MTIME_ADDRESS
+#error "Define the address of the mtime register (RTE_RISCV_MTIME_ADDRESS) in the rtedbg_config.h."
+#endif
+
+#define RTE_TIMESTAMP_COUNTER_BITS  32U  // Number of timer counter bits available for the timestamp
+
+#define RTE_RISCV_MTIME_LOW   (*(volatile uint32_t *)(uintptr_t)(RTE_RISCV_MTIME_ADDRESS))
+#define RTE_RISCV_MTIME_HIGH  (*(volatile uint32_t *)(uintptr_t)((RTE_RISCV_MTIME_ADDRESS) + 4U))
+
+#if !defined RTE_USE_INLINE_FUNCTIONS
+
+/***
+ * @brief The machine timer is free running and initialized by the startup code
+ *        or RTOS - nothing to do here.
+ */
+
+__STATIC_FORCEINLINE void rte_init_timestamp_counter(void)
+{
+}
+#endif  // !defined RTE_USE_INLINE_FUNCTIONS
+
+
+/***
+ * @brief Get the current value of the timestamp counter.
+ *
+ * @return Bottom 32 bits of the mtime register.
+ */
+
+__STATIC_FORCEINLINE uint32_t rte_get_timestamp(void)
+{
+    return RTE_RISCV_MTIME_LOW;
+}
+
+
+#if (RTE_USE_LONG_TIMESTAMP != 0) && (!defined RTE_USE_INLINE_FUNCTIONS)
+
+/*********************************************************************************
+ * @brief Writes a message with a long timestamp to the buffer.
+ *        The low bits of the timestamp are included in the message words with the
+ *        format ID. Only the higher 32 bits are transmitted in the message's
+ *        data part.
+ *
+ * @note  The complete 64-bit timer value is read, so the function may be called
+ *        from any part of the program - e.g. from a timer interrupt routine.
+ *********************************************************************************/
+
+RTE_OPTIM_SIZE void rte_long_timestamp(void)
+{
+    uint32_t high;
+    uint32_t low;
+    uint32_t high2;
+
+    do          // Repeat if the bottom part overflowed between the two reads
+    {
+        high = RTE_RISCV_MTIME_HIGH;
+        low = RTE_RISCV_MTIME_LOW;
+        high2 = RTE_RISCV_MTIME_HIGH;
+    }
+    while (high != high2);
+
+    uint64_t timestamp_64 = (uint64_t)low | ((uint64_t)high << 32U);
+    uint32_t long_t_stamp = (uint32_t)(timestamp_64 >>
+                                       ((32U - ((uint32_t)(RTE_FMT_ID_BITS))) - 1U + (RTE_TIMESTAMP_SHIFT)));
+    RTE_MSG1(MSG1_LONG_TIMESTAMP, F_SYSTEM, long_t_stamp);
+}
+
+#endif // (RTE_USE_LONG_TIMESTAMP != 0) && (!defined RTE_USE_INLINE_FUNCTIONS)
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* RTEDBG_TIMER_RISCV_MTIME_H_ */
+
+/*==== End of file ====*/
@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2024 Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rtedbg_watchlist.c
+ * @author  Branko Premzel
+ * @brief   Periodic sampling of a list of variables - see rtedbg_watchlist.h.
+ *          The values are written directly to the circular buffer with the
+ *          RTE_RESERVE() / rte_commit() functions (no intermediate copy).
+ *
+ * @version RTEdbg library <DEVELOPMENT BRANCH>
+ ******************************************************************************/
+
+#include "rtedbg_watchlist.h"
+
+#if RTE_ENABLED != 0
+
+/*********************************************************************************
+ * @brief Log the values of all enabled watch list entries as one message.
+ *        The address and size of the entries are copied first and the space for the
+ *        complete message is reserved with a single reservation. Only the copies are
+ *        used to read the values, so the host can edit the entries at any time -
+ *        changes made during the sampling take effect with the next call.
+ *
+ * @param fmt_id  Format ID number - see the description of __rte_msgn().
+ * @param list    Watch list
+ *
+ * @note  The message is discarded if it is longer than RTE_MAX_MSG_SIZE. Lists with
+ *        more than RTE_WATCH_MAX_ENTRIES entries are not sampled - see list->rejected.
+ *********************************************************************************/
+
+void __rte_sample_watchlist(const uint32_t fmt_id, rte_watchlist_t * const list)
+{
+    volatile const void *entry_address[RTE_WATCH_MAX_ENTRIES];  // NULL = entry not sampled
+    uint16_t entry_size[RTE_WATCH_MAX_ENTRIES];                 // Size of the sampled entry
+    const uint32_t count = list->count;
+
+    if (count > RTE_WATCH_MAX_ENTRIES)
+    {
+        list->rejected++;
+        return;
+    }
+
+    const uint32_t mask_words = (count == 0U) ? 1U : ((count + 31U) / 32U);
+    uint32_t data_words = mask_words;
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        const rte_watch_t * const entry = &list->entry[i];
+        volatile const void * const address = entry->address;
+        const uint32_t size = entry->size;
+        entry_address[i] = NULL;
+
+        if ((entry->enabled != 0U) && (address != NULL) && (size != 0U)
+            && (size <= RTE_MAX_MSG_SIZE))
+        {
+            entry_address[i] = address;
+            entry_size[i] = (uint16_t)size;
+            data_words += (size + 3U) / 4U;
+        }
+    }
+
+    rte_reservation_t res;
+    __rte_reserve(fmt_id, &res, data_words);
+    if (!RTE_RESERVED(res))
+    {
+        return;
+    }
+
+    // Mask words
+    for (uint32_t k = 0U; k < mask_words; k++)
+    {
+        uint32_t mask = 0U;
+        for (uint32_t n = 0U; (n < 32U) && (((32U * k) + n) < count); n++)
+        {
+            if (entry_address[(32U * k) + n] != NULL)
+            {
+                mask |= 1UL << n;
+            }
+        }
+        rte_reserved_write(&res, k, mask);
+    }
+
+    // Values of the sampled entries
+    uint32_t n = mask_words;
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        volatile const void * const address = entry_address[i];
+        if (address == NULL)
+        {
+            continue;
+        }
+
+        const uint32_t size = entry_size[i];
+        if (size == 1U)
+        {
+            rte_reserved_write(&res, n, *(volatile const uint8_t *)address);
+            n++;
+        }
+        else if (size == 2U)
+        {
+            rte_reserved_write(&res, n, *(volatile const uint16_t *)address);
+            n++;
+        }
+        else
+        {
+            volatile const uint32_t *value = (volatile const uint32_t *)address;
+            for (uint32_t w = 0U; w < ((size + 3U) / 4U); w++)
+            {
+                rte_reserved_write(&res, n, value[w]);
+                n++;
+            }
+        }
+    }
+
+    rte_commit(&res);
+}
+
+
+/*********************************************************************************
+ * @brief Add a variable to the first free entry of a watch list (address = NULL).
+ *
+ * @param list     Watch list
+ * @param address  Address of the variable
+ * @param size     Size of the variable [bytes]
+ *
+ * @return Number of the entry or 0xFFFFFFFF if the list is full
+ *
+ * @note  The function must not be called from more than one task at the same time.
+ *********************************************************************************/
+
+uint32_t rte_watch_add(rte_watchlist_t * const list, volatile const void * const address,
+                       const uint32_t size)
+{
+    for (uint32_t i = 0U; (i < list->count) && (i < RTE_WATCH_MAX_ENTRIES); i++)
+    {
+        rte_watch_t * const entry = &list->entry[i];
+        if (entry->address == NULL)
+        {
+            // The entry is enabled after its address and size have been set
+            entry->enabled = 0U;
+            entry->size = size;
+            entry->address = address;
+            entry->enabled = 1U;
+            return i;
+        }
+    }
+
+    return 0xFFFFFFFFU;
+}
+
+#endif // RTE_ENABLED != 0
+
+/*==== End of file ====*/
@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2024 Branko Premzel.
+ *
+ * SPDX-License-Identifier: MIT
+ */
+
+/*******************************************************************************
+ * @file    rtedbg_watchlist.h
+ * @author  Branko Premzel
+ * @brief   Periodic sampling of a list of variables. All enabled variables of a
+ *          watch list are logged as a single __rte_msgn() type message - with one
+ *          buffer space reservation and timestamp instead of one message for each
+ *          variable. Call RTE_SAMPLE_WATCHLIST() e.g. from a timer interrupt.
+ *          The list can be defined at compile time:
+ *              static rte_watch_t motor_vars[] =
+ *              {
+ *                  RTE_WATCH(motor_speed),
+ *                  RTE_WATCH(motor_current),
+ *                  RTE_WATCH(pwm_duty)
+ *              };
+ *              rte_watchlist_t g_motor_watch = RTE_WATCHLIST(motor_vars);
+ *          or filled at runtime with rte_watch_add() (entries initialized with
+ *          RTE_WATCH_EMPTY). The host (debug probe) can enable, disable or re-point
+ *          the entries by editing the list in RAM while the firmware is running.
+ *
+ *          Message contents (DATA words):
+ *          - (count + 31) / 32 mask words: bit n of mask word k = 1 if entry
+ *            #(32 * k + n) has been sampled
+ *          - the values of the sampled entries in the order of the list. Variables
+ *            with a size of 1 or 2 bytes are logged as one word (not sign extended),
+ *            larger ones as size / 4 words (rounded up).
+ *          The format definition describes the message with all entries enabled.
+ *          The mask words show which values are present if the host has disabled some.
+ *
+ * @note    The variables of 4 or more bytes must be word aligned. Values larger
+ *          than one word are not read atomically.
+ *
+ * @note    The address and size of all entries are copied to the stack before the
+ *          space for the message is reserved (about 6 bytes per entry on a 32-bit CPU).
+ *          Reduce RTE_WATCH_MAX_ENTRIES in the rtedbg_config.h if the stack of the
+ *          sampling interrupt is small.
+ *
+ * @version RTEdbg library <DEVELOPMENT BRANCH>
+ ******************************************************************************/
+
+#ifndef RTEDBG_WATCHLIST_H
+#define RTEDBG_WATCHLIST_H
+
+#include "rtedbg.h"
+
+#if !defined RTE_WATCH_MAX_ENTRIES
+#define RTE_WATCH_MAX_ENTRIES   64U     // Maximal number of entries in a watch list
+#endif
+
+#if ((RTE_WATCH_MAX_ENTRIES) < 1U) || ((RTE_WATCH_MAX_ENTRIES) > 1024U)
+#error "The RTE_WATCH_MAX_ENTRIES must have a value from 1 to 1024."
+#endif
+
+typedef struct
+{
+    volatile const void * volatile address; // Address of the variable (NULL = entry not used)
+    volatile uint32_t size;                 // Size of the variable [bytes]
+    volatile uint32_t enabled;              // 0 = the variable is not sampled
+} rte_watch_t;
+
+typedef struct
+{
+    rte_watch_t *entry;             // Array of watch list entries
+    uint32_t count;                 // Number of entries in the array (max. RTE_WATCH_MAX_ENTRIES)
+    volatile uint32_t rejected;     // Samples not logged because count > RTE_WATCH_MAX_ENTRIES
+} rte_watchlist_t;
+
+// Watch list entry initializers
+#define RTE_WATCH(variable)     { &(variable), (uint32_t)sizeof(variable), 1U }
+#define RTE_WATCH_EMPTY         { NULL, 0U, 0U }
+
+// Watch list initializer for a static array of entries
+#define RTE_WATCHLIST(entries)  { (entries), (uint32_t)(sizeof(entries) / sizeof((entries)[0])), 0U }
+
+#if RTE_ENABLED != 0
+#define RTE_SAMPLE_WATCHLIST(fmt, filter_no, list)                                  \
+{                                                                                   \
+    RTE_CHECK_PARAMETERS(filter_no, fmt, 15U);                                      \
+    __rte_sample_watchlist(RTE_PACK(filter_no, fmt, 4U), list);                     \
+}
+
+void __rte_sample_watchlist(const uint32_t fmt_id, rte_watchlist_t * const list);
+uint32_t rte_watch_add(rte_watchlist_t * const list, volatile const void * const address,
+                       const uint32_t size);
+#else
+#define RTE_SAMPLE_WATCHLIST(fmt, filter_no, list)
+#define rte_watch_add(list, address, size) 0xFFFFFFFFU
+#endif
+
+#endif  // RTEDBG_WATCHLIST_H
+
+/*==== End of file ====*/
@@ -28,7 +28,181 @@
 #include RTE_TIMER_DRIVER   // Timestamp timer driver
 #include RTE_CPU_DRIVER     // Buffer space reservation macro specific to the CPU
 
-rtedbg_t g_rtedbg RTE_DBG_RAM;  //!< Data structure with circular logging buffer
+// Output of a completely written message - defined by a CPU driver (e.g. rtedbg_cortex_m_itm.h)
+#if !defined RTE_MSG_OUTPUT
+#define RTE_MSG_OUTPUT(buffer, index, size)  {(void)(index); (void)(size);}
+#endif
+
+#if (RTE_SMP_CORES) > 1U
+rtedbg_t g_rtedbg[RTE_SMP_CORES] RTE_DBG_RAM RTE_CACHE_ALIGNED;  //!< Data structures with circular logging buffers - one per CPU core
+#else
+rtedbg_t g_rtedbg RTE_DBG_RAM RTE_CACHE_ALIGNED;  //!< Data structure with circular logging buffer
+#endif
+
+#if RTE_SHARED_RTEDBG != 0
+rtedbg_t *g_rte_shared_rtedbg = &g_rtedbg;  //!< Address of the data logging structure - see rte_set_rtedbg()
+#endif
+
+#if (RTE_CHANNELS) > 1U
+#if !defined RTE_DBG_RAM_CH1
+#define RTE_DBG_RAM_CH1  RTE_DBG_RAM
+#endif
+#if !defined RTE_DBG_RAM_CH2
+#define RTE_DBG_RAM_CH2  RTE_DBG_RAM
+#endif
+#if !defined RTE_DBG_RAM_CH3
+#define RTE_DBG_RAM_CH3  RTE_DBG_RAM
+#endif
+
+rtedbg_t g_rtedbg_ch1 RTE_DBG_RAM_CH1 RTE_CACHE_ALIGNED;  //!< Data structure of logging channel #1
+#define RTE_CH1_RTEDBG  (&g_rtedbg_ch1)
+#if (RTE_CHANNELS) > 2U
+rtedbg_t g_rtedbg_ch2 RTE_DBG_RAM_CH2 RTE_CACHE_ALIGNED;  //!< Data structure of logging channel #2
+#define RTE_CH2_RTEDBG  (&g_rtedbg_ch2)
+#else
+#define RTE_CH2_RTEDBG  (&g_rtedbg)     // Not used - no filters are assigned to the channel
+#endif
+#if (RTE_CHANNELS) > 3U
+rtedbg_t g_rtedbg_ch3 RTE_DBG_RAM_CH3 RTE_CACHE_ALIGNED;  //!< Data structure of logging channel #3
+#define RTE_CH3_RTEDBG  (&g_rtedbg_ch3)
+#else
+#define RTE_CH3_RTEDBG  (&g_rtedbg)     // Not used - no filters are assigned to the channel
+#endif
+
+//! Descriptor table for the host software - number and addresses of the logging channels
+const rte_channel_table_t g_rte_channel_table =
+{
+    RTE_CHANNELS,
+    {
+        &g_rtedbg,
+        &g_rtedbg_ch1,
+#if (RTE_CHANNELS) > 2U
+        &g_rtedbg_ch2,
+#endif
+#if (RTE_CHANNELS) > 3U
+        &g_rtedbg_ch3,
+#endif
+    }
+};
+
+// Channel of filter #n - filter #0 is bit 31 of the RTE_CHANNELx_FILTERS mask.
+#define RTE_FILTER_CHANNEL(n)                                                         \
+    ((((uint32_t)(RTE_CHANNEL1_FILTERS) & (1UL << (31U - (n)))) != 0U) ? RTE_CH1_RTEDBG : \
+     (((uint32_t)(RTE_CHANNEL2_FILTERS) & (1UL << (31U - (n)))) != 0U) ? RTE_CH2_RTEDBG : \
+     (((uint32_t)(RTE_CHANNEL3_FILTERS) & (1UL << (31U - (n)))) != 0U) ? RTE_CH3_RTEDBG : \
+     &g_rtedbg)
+
+//! Data logging structure for each of the 32 filter numbers (message groups)
+rtedbg_t * const g_rte_filter_channel[32] =
+{
+    RTE_FILTER_CHANNEL( 0U), RTE_FILTER_CHANNEL( 1U), RTE_FILTER_CHANNEL( 2U), RTE_FILTER_CHANNEL( 3U),
+    RTE_FILTER_CHANNEL( 4U), RTE_FILTER_CHANNEL( 5U), RTE_FILTER_CHANNEL( 6U), RTE_FILTER_CHANNEL( 7U),
+    RTE_FILTER_CHANNEL( 8U), RTE_FILTER_CHANNEL( 9U), RTE_FILTER_CHANNEL(10U), RTE_FILTER_CHANNEL(11U),
+    RTE_FILTER_CHANNEL(12U), RTE_FILTER_CHANNEL(13U), RTE_FILTER_CHANNEL(14U), RTE_FILTER_CHANNEL(15U),
+    RTE_FILTER_CHANNEL(16U), RTE_FILTER_CHANNEL(17U), RTE_FILTER_CHANNEL(18U), RTE_FILTER_CHANNEL(19U),
+    RTE_FILTER_CHANNEL(20U), RTE_FILTER_CHANNEL(21U), RTE_FILTER_CHANNEL(22U), RTE_FILTER_CHANNEL(23U),
+    RTE_FILTER_CHANNEL(24U), RTE_FILTER_CHANNEL(25U), RTE_FILTER_CHANNEL(26U), RTE_FILTER_CHANNEL(27U),
+    RTE_FILTER_CHANNEL(28U), RTE_FILTER_CHANNEL(29U), RTE_FILTER_CHANNEL(30U), RTE_FILTER_CHANNEL(31U)
+};
+#endif // (RTE_CHANNELS) > 1U
+
+#if RTE_DUAL_BANK != 0
+#if !defined RTE_DBG_RAM_BANK1
+#define RTE_DBG_RAM_BANK1  RTE_DBG_RAM
+#endif
+
+rtedbg_t g_rtedbg_bank1 RTE_DBG_RAM_BANK1 RTE_CACHE_ALIGNED;  //!< Data structure of bank #1
+
+//! Bank descriptor for the host software - active bank, swap counters and bank addresses
+rte_bank_table_t g_rte_bank_table =
+{
+    &g_rtedbg, 0U, 0U, 0U,
+    {
+        &g_rtedbg,
+        &g_rtedbg_bank1
+    }
+};
+#endif // RTE_DUAL_BANK != 0
+
+#if RTE_RESERVATION_STATS != 0
+#if (RTE_SMP_CORES) > 1U
+rte_reservation_stats_t g_rte_reservation_stats[RTE_SMP_CORES];  //!< Reservation statistics - one per CPU core
+#else
+rte_reservation_stats_t g_rte_reservation_stats;  //!< Buffer space reservation statistics
+#endif
+#endif
+
+#if RTE_GROUP_DECIMATION != 0
+rte_decimation_t g_rte_decimation;  //!< Message group decimation dividers and counters
+#endif
+
+#if RTE_GROUP_WORD_STATS != 0
+volatile uint32_t g_rte_group_words[32];  //!< Number of words logged by each message group
+#endif
+
+#if RTE_TRIGGER_ENABLED != 0
+rte_trigger_t g_rte_trigger;        //!< Trigger mode state
+#endif
+
+#if RTE_AUTO_LONG_TIMESTAMP != 0
+#if (RTE_SMP_CORES) > 1U
+volatile uint32_t g_rte_long_tstamp[RTE_SMP_CORES];  //!< Automatic long timestamp state - one per CPU core
+#else
+volatile uint32_t g_rte_long_tstamp;    //!< Automatic long timestamp state
+#endif
+#endif
+
+#if RTE_DEFERRED_ERASE != 0
+static volatile uint32_t rte_erase_pending; //!< Bit n set = circular buffer of core n not yet erased
+static uint32_t rte_erase_index;            //!< Index of the next word to be erased
+static uint32_t rte_erase_config;           //!< rte_cfg value written after the buffer has been erased
+static uint32_t rte_erase_filter;           //!< Filter value set after all buffers have been erased
+#endif
+
+#if ((RTE_CACHE_LINE_SIZE) != 0U) && defined RTE_DCACHE_CLEAN
+static uint32_t rte_clean_index[RTE_RTEDBG_COUNT];  //!< buf_index at the last rte_dcache_clean() call
+
+/********************************************************************************
+ * @brief Clean the complete data logging structures in the data cache after they
+ *        have been initialized or erased. The next rte_dcache_clean() call then
+ *        cleans only the data logged after this call.
+ ********************************************************************************/
+
+RTE_OPTIM_SIZE static void rte_dcache_clean_all(void)
+{
+    for (uint32_t core = 0U; core < RTE_RTEDBG_COUNT; core++)
+    {
+        rtedbg_t *p_rtedbg = RTE_CORE_RTEDBG(core);
+        rte_clean_index[core] = p_rtedbg->buf_index;
+        RTE_DCACHE_CLEAN(p_rtedbg, sizeof(rtedbg_t));
+    }
+}
+#endif
+
+#if RTE_DEFERRED_ERASE == 0
+/********************************************************************************
+ * @brief Set all words of the circular buffer to the erased state.
+ *
+ * @param  p_rtedbg  Data logging structure
+ ********************************************************************************/
+
+RTE_OPTIM_SIZE static void rte_erase_buffer(rtedbg_t * const p_rtedbg)
+{
+#if defined RTE_USE_MEMSET
+    memset(&p_rtedbg->buffer, RTE_ERASED_STATE & 0xFFu, sizeof(p_rtedbg->buffer));
+#else
+    int32_t count = (int32_t)((sizeof(p_rtedbg->buffer) / sizeof(uint32_t)) - 1U);
+    do
+    {
+        *((volatile uint32_t *)(&p_rtedbg->buffer[(unsigned)count])) = RTE_ERASED_STATE;  //lint !e929
+            // volatile used to prevent compiler from using the memset() function
+            // memset() is slow in many embedded system library implementations (setting bytes instead of words)
+        count--;
+    }
+    while (count >= 0);
+#endif
+}
+#endif // RTE_DEFERRED_ERASE == 0
 
 /********************************************************************************
  * @brief Initialize the data structures and clear the circular buffer if necessary.
@@ -56,6 +230,19 @@ rtedbg_t g_rtedbg RTE_DBG_RAM;  //!< Data structure with circular logging buffer
  * @note  When the data logging mode is switched from post-mortem to single shot or vice
  *        versa by the firmware, the data logging buffer is completely cleared.
  *
+ * @note  If RTE_SMP_CORES > 1, the data logging structures of all CPU cores are
+ *        initialized. Call this function only once (from one of the cores).
+ *        The same applies to the data logging structures of all channels if
+ *        RTE_CHANNELS > 1.
+ *
+ * @note  Streaming mode (RTE_STREAMING_ENABLED = 1): The buffer is always cleared and
+ *        the data not yet read by rte_stream_read() is discarded. A message that was
+ *        only partially written before a reset would otherwise block the streaming.
+ *
+ * @note  Deferred erase (RTE_DEFERRED_ERASE = 1): The buffer is not cleared by this
+ *        function. Message logging is disabled on all CPU cores until the buffers are
+ *        erased with rte_erase_step() or rte_erase_done() - see below.
+ *
  * @warning Multi-threaded systems: The message filter should not be enabled in any of
  *          the threads until this function has finished executing in the thread that
  *          called it. You should also make sure that all tasks have finished writing
@@ -73,62 +260,252 @@ RTE_OPTIM_SIZE void rte_init(const uint32_t initial_filter_value, const uint32_t
     if ((init_mode & RTE_SINGLE_SHOT_LOGGING_IS_ACTIVE) != 0U)
     {
         config_id |= RTE_SINGLE_SHOT_LOGGING_IS_ACTIVE;
-        g_rtedbg.buf_index = 0U;
     }
 #endif // RTE_SINGLE_SHOT_ENABLED != 0
 
-    // If g_rtedbg has not yet been initialized, clear the header and circular buffer.
-    if ((g_rtedbg.rte_cfg != config_id) || (init_mode >= RTE_RESTART_LOGGING))
+    // Initialize the data logging structures of all CPU cores (only one if RTE_SMP_CORES == 1).
+    for (uint32_t core = 0U; core < RTE_RTEDBG_COUNT; core++)
     {
-        /* Disable logging so that no task logs data during initialization. */
-        g_rtedbg.filter = 0U;
-        RTE_DATA_MEMORY_BARRIER();  // Make sure all CPU cores see the change.
+        rtedbg_t *p_rtedbg = RTE_CORE_RTEDBG(core);
 
-        /* Initialize the g_rtedbg structure and buffer after a power-on reset or reboot. The
-         * circular buffer must be set to 0xFFFFFFFF. This is the only value that does not
-         * appear as normal data and enables the rtemsg data decoding software to detect that
-         * part of the buffer has been reserved but not yet written to - e.g. because the task
-         * logging data has been interrupted for a long time by higher priority tasks or services. */
-#if defined RTE_USE_MEMSET
-        memset(&g_rtedbg.buffer, RTE_ERASED_STATE & 0xFFu, sizeof(g_rtedbg.buffer));
-#else
-        int32_t count = (int32_t)((sizeof(g_rtedbg.buffer) / sizeof(uint32_t)) - 1U);
-        do
+#if RTE_SINGLE_SHOT_ENABLED != 0
+        if ((init_mode & RTE_SINGLE_SHOT_LOGGING_IS_ACTIVE) != 0U)
         {
-            *((volatile uint32_t *)(&g_rtedbg.buffer[(unsigned)count])) = RTE_ERASED_STATE;  //lint !e929
-                // volatile used to prevent compiler from using the memset() function
-                // memset() is slow in many embedded system library implementations (setting bytes instead of words)
-            count--;
+            p_rtedbg->buf_index = 0U;
+#if RTE_LOSS_STATS != 0
+            p_rtedbg->too_long_count = 0U;      // New single-shot capture
+            p_rtedbg->buffer_full_count = 0U;
+#endif
         }
-        while (count >= 0);
-#endif // defined RTE_USE_MEMSET
+#endif // RTE_SINGLE_SHOT_ENABLED != 0
+
+        // If g_rtedbg has not yet been initialized, clear the header and circular buffer.
+        // The buffer is always cleared in streaming mode - see the note above.
+        if ((p_rtedbg->rte_cfg != config_id) || (init_mode >= RTE_RESTART_LOGGING)
+            || (RTE_STREAMING_ENABLED != 0))                                //lint !e506
+        {
+            /* Disable logging so that no task logs data during initialization. */
+            p_rtedbg->filter = 0U;
+            RTE_DATA_MEMORY_BARRIER();  // Make sure all CPU cores see the change.
+
+            /* Initialize the g_rtedbg structure and buffer after a power-on reset or reboot. The
+             * circular buffer must be set to 0xFFFFFFFF. This is the only value that does not
+             * appear as normal data and enables the rtemsg data decoding software to detect that
+             * part of the buffer has been reserved but not yet written to - e.g. because the task
+             * logging data has been interrupted for a long time by higher priority tasks or services. */
+#if RTE_DEFERRED_ERASE != 0
+            rte_erase_pending |= 1UL << core;   // Erased later by rte_erase_step() or rte_erase_done()
+#else
+            rte_erase_buffer(p_rtedbg);
+#endif // RTE_DEFERRED_ERASE != 0
 
 #if (RTE_FILTER_OFF_ENABLED != 0) && (RTE_MSG_FILTERING_ENABLED != 0)
-        g_rtedbg.filter = initial_filter_value;
+            p_rtedbg->filter = initial_filter_value;
 #if RTE_FIRMWARE_MAY_SET_FILTER == 1
-        g_rtedbg.filter_copy = initial_filter_value;
+            p_rtedbg->filter_copy = initial_filter_value;
 #endif
 #endif
-        g_rtedbg.buf_index = 0U;
-    }
+            p_rtedbg->buf_index = 0U;
+#if RTE_STREAMING_ENABLED != 0
+            p_rtedbg->rd_index = 0U;
+            p_rtedbg->overrun_count = 0U;
+#endif
+#if RTE_LOSS_STATS != 0
+            p_rtedbg->too_long_count = 0U;
+            p_rtedbg->buffer_full_count = 0U;
+#endif
+        }
+
+        p_rtedbg->rte_cfg = config_id;
+        p_rtedbg->buffer_size = (uint32_t)(RTE_BUFFER_SIZE) + 4U;
+#if RTE_WRITE_POSITION != 0
+        p_rtedbg->index_mask = (uint32_t)(RTE_BUFFER_SIZE) - 1U;
+#endif
 
-    g_rtedbg.rte_cfg = config_id;
-    g_rtedbg.buffer_size = (uint32_t)(RTE_BUFFER_SIZE) + 4U;
+#if RTE_RESERVATION_STATS != 0
+#if (RTE_SMP_CORES) > 1U
+        rte_reservation_stats_t *p_stats = &g_rte_reservation_stats[core];
+#else
+        rte_reservation_stats_t *p_stats = &g_rte_reservation_stats;
+#endif
+        p_stats->attempts = 0U;
+        p_stats->retries = 0U;
+        p_stats->max_retries = 0U;
+#endif
+
+        // Set the timestamp frequency
+        p_rtedbg->timestamp_frequency = RTE_GET_TSTAMP_FREQUENCY();
+#if (RTE_FILTER_OFF_ENABLED == 0) && (RTE_MSG_FILTERING_ENABLED != 0)
+        p_rtedbg->filter = initial_filter_value;
+#endif
+    }
 
-    // Set the timestamp frequency and initialize the timestamp timer
-    g_rtedbg.timestamp_frequency = RTE_GET_TSTAMP_FREQUENCY();
+    // Initialize the timestamp timer
     rte_init_timestamp_counter();
 
+#if RTE_AUTO_LONG_TIMESTAMP != 0
+    // Start with the current value of the timestamp counter bits above the logged ones
+    const uint32_t long_tstamp = rte_get_timestamp() >> RTE_TSTAMP_TOP_BIT;
+#if (RTE_SMP_CORES) > 1U
+    for (uint32_t core = 0U; core < RTE_SMP_CORES; core++)
+    {
+        g_rte_long_tstamp[core] = long_tstamp;
+    }
+#else
+    g_rte_long_tstamp = long_tstamp;
+#endif
+#endif
+
 #if RTE_FILTER_OFF_ENABLED != 0
     rte_set_filter(initial_filter_value);
-#else
-#if RTE_MSG_FILTERING_ENABLED != 0
-    g_rtedbg.filter = initial_filter_value;
 #endif
+
+#if RTE_DEFERRED_ERASE != 0
+    if (rte_erase_pending != 0U)
+    {
+        // Disable logging until the buffers are erased. The rte_cfg of a buffer that has
+        // not been erased yet is cleared so that the erase is repeated after a reset.
+        rte_erase_index = 0U;
+        rte_erase_config = config_id;
+        rte_erase_filter = RTE_CORE_RTEDBG(0U)->filter;
+
+        for (uint32_t core = 0U; core < RTE_RTEDBG_COUNT; core++)
+        {
+            rtedbg_t *p_rtedbg = RTE_CORE_RTEDBG(core);
+            p_rtedbg->filter = 0U;
+            if ((rte_erase_pending & (1UL << core)) != 0U)
+            {
+                p_rtedbg->rte_cfg = 0U;
+            }
+        }
+        RTE_DATA_MEMORY_BARRIER();  // Make sure all CPU cores see the change.
+    }
+#endif
+
+#if ((RTE_CACHE_LINE_SIZE) != 0U) && defined RTE_DCACHE_CLEAN
+    rte_dcache_clean_all();
+#endif
+
+#if RTE_AUTO_LONG_TIMESTAMP != 0
+    RTE_MSG1(MSG1_LONG_TIMESTAMP, F_SYSTEM, long_tstamp >> 1U)    // Initial long timestamp value
+#endif
+}
+
+
+#if RTE_DEFERRED_ERASE != 0
+
+/********************************************************************************
+ * @brief Enable message logging after all circular buffers have been erased.
+ ********************************************************************************/
+
+RTE_OPTIM_SIZE static void rte_erase_finished(void)
+{
+    RTE_DATA_MEMORY_BARRIER();      // Buffer contents must be visible before logging starts.
+    for (uint32_t core = 0U; core < RTE_RTEDBG_COUNT; core++)
+    {
+        rtedbg_t *p_rtedbg = RTE_CORE_RTEDBG(core);
+        p_rtedbg->rte_cfg = rte_erase_config;
+        p_rtedbg->filter = rte_erase_filter;
+    }
+    RTE_DATA_MEMORY_BARRIER();
+#if ((RTE_CACHE_LINE_SIZE) != 0U) && defined RTE_DCACHE_CLEAN
+    rte_dcache_clean_all();
 #endif
 }
 
 
+/********************************************************************************
+ * @brief Erase the next part of the circular buffer(s) not erased by rte_init().
+ *        Message logging is enabled (with the filter value defined by rte_init())
+ *        after the last word has been erased.
+ *        Call the function repeatedly, e.g. from the idle task, until it returns 0.
+ *
+ * @param  max_words  Maximum number of words to be erased during this call
+ *
+ * @return Number of words that still have to be erased (0 - erase complete)
+ *
+ * @note   The function must not be called from more than one task at the same time.
+ ********************************************************************************/
+
+RTE_OPTIM_SIZE uint32_t rte_erase_step(const uint32_t max_words)
+{
+    const uint32_t size = (uint32_t)(RTE_BUFFER_SIZE) + 4U;
+    uint32_t count = max_words;
+    uint32_t pending = rte_erase_pending;
+
+    if (pending == 0U)
+    {
+        return 0U;
+    }
+
+    for (uint32_t core = 0U; (core < RTE_RTEDBG_COUNT) && (count != 0U); core++)
+    {
+        if ((pending & (1UL << core)) == 0U)
+        {
+            continue;
+        }
+
+        rtedbg_t *p_rtedbg = RTE_CORE_RTEDBG(core);
+        uint32_t index = rte_erase_index;
+        uint32_t end = ((size - index) > count) ? (index + count) : size;
+        count -= end - index;
+
+        while (index < end)
+        {
+            *((volatile uint32_t *)(&p_rtedbg->buffer[index])) = RTE_ERASED_STATE;  //lint !e929
+            index++;
+        }
+
+        if (index < size)
+        {
+            rte_erase_index = index;
+            break;
+        }
+
+        rte_erase_index = 0U;
+        pending &= ~(1UL << core);
+    }
+
+    rte_erase_pending = pending;
+    if (pending == 0U)
+    {
+        rte_erase_finished();
+        return 0U;
+    }
+
+    // Number of words still to be erased
+    uint32_t remaining = 0U;
+    for (uint32_t core = 0U; core < RTE_RTEDBG_COUNT; core++)
+    {
+        if ((pending & (1UL << core)) != 0U)
+        {
+            remaining += size;
+        }
+    }
+    return remaining - rte_erase_index;
+}
+
+
+/********************************************************************************
+ * @brief Enable message logging after the circular buffer(s) have been erased by
+ *        the firmware, e.g. with a DMA transfer started after rte_init(). All words
+ *        of g_rtedbg.buffer must be set to RTE_ERASED_STATE (0xFFFFFFFF) before the
+ *        function is called.
+ ********************************************************************************/
+
+RTE_OPTIM_SIZE void rte_erase_done(void)
+{
+    if (rte_erase_pending != 0U)
+    {
+        rte_erase_pending = 0U;
+        rte_erase_index = 0U;
+        rte_erase_finished();
+    }
+}
+
+#endif // RTE_DEFERRED_ERASE != 0
+
+
 /********************************************************************************
  * @brief Write only format ID and timestamp to circular buffer.
  *
@@ -144,25 +521,30 @@ RTE_OPTIM_SIZE void rte_init(const uint32_t initial_filter_value, const uint32_t
 
 RTE_OPTIM_SPEED void __rte_msg0(const uint32_t fmt_id)
 {
-    rtedbg_t *p_rtedbg = &g_rtedbg;
+    rtedbg_t *p_rtedbg = RTE_MSG_RTEDBG(fmt_id, 0U);
 
 #if RTE_DELAYED_TSTAMP_READ != 1
     uint32_t timestamp = (rte_get_timestamp() >> ((RTE_TIMESTAMP_SHIFT) - 1U)) & RTE_TIMESTAMP_MASK;
+    RTE_LONG_TIMESTAMP_CHECK(timestamp)
 #endif
 
-    if (RTE_MESSAGE_DISABLED(p_rtedbg->filter, fmt_id, 0U))
+    if (RTE_MESSAGE_SKIPPED(p_rtedbg->filter, fmt_id, 0U))
     {
         return;     // Discard the message if not enabled
     }
 
+    RTE_LONG_TIMESTAMP_PRECHECK()
     uint32_t buf_index;
     RTE_RESERVE_SPACE(p_rtedbg, buf_index, 1U);                             //lint !e717
+    RTE_TRIGGER_CHECK(fmt_id, 0U, buf_index, 1U)
+    RTE_COUNT_GROUP_WORDS(fmt_id, 0U, 1U)
 
 #if RTE_DELAYED_TSTAMP_READ != 0
     uint32_t timestamp = (rte_get_timestamp() >> ((RTE_TIMESTAMP_SHIFT) - 1U)) & RTE_TIMESTAMP_MASK;
 #endif
 
     p_rtedbg->buffer[buf_index] = timestamp | 1U | (fmt_id << (32U - (uint32_t)(RTE_FMT_ID_BITS)));
+    RTE_MSG_OUTPUT(p_rtedbg->buffer, buf_index, 1U)
 }
 
 
@@ -175,23 +557,27 @@ RTE_OPTIM_SPEED void __rte_msg0(const uint32_t fmt_id)
 
 RTE_OPTIM_SPEED void __rte_msg1(const uint32_t fmt_id, const rte_any32_t data1)
 {
-    rtedbg_t *p_rtedbg = &g_rtedbg;
+    rtedbg_t *p_rtedbg = RTE_MSG_RTEDBG(fmt_id, 1U);
 
 #if RTE_DELAYED_TSTAMP_READ != 1
     uint32_t timestamp = (rte_get_timestamp() >> ((RTE_TIMESTAMP_SHIFT) - 1U)) & RTE_TIMESTAMP_MASK;
+    RTE_LONG_TIMESTAMP_CHECK(timestamp)
 #endif
 
-    if (RTE_MESSAGE_DISABLED(p_rtedbg->filter, fmt_id, 1U))
+    if (RTE_MESSAGE_SKIPPED(p_rtedbg->filter, fmt_id, 1U))
     {
         return;
     }
 
+    RTE_LONG_TIMESTAMP_PRECHECK()
     uint32_t buf_index;
     RTE_RESERVE_SPACE(p_rtedbg, buf_index, 2U);                             //lint !e717
+    RTE_TRIGGER_CHECK(fmt_id, 1U, buf_index, 2U)
+    RTE_COUNT_GROUP_WORDS(fmt_id, 1U, 2U)
 
     rte_pack_data_t data;                                                   //lint !e9018
     data.w32.bits31 = fmt_id;
-    uint32_t *data_packet = &g_rtedbg.buffer[buf_index];
+    uint32_t *data_packet = &p_rtedbg->buffer[buf_index];
 
     data.w32.data = RTE_PARAM(data1);
     data.w64 <<= 1U;
@@ -202,6 +588,7 @@ RTE_OPTIM_SPEED void __rte_msg1(const uint32_t fmt_id, const rte_any32_t data1)
     uint32_t timestamp = (rte_get_timestamp() >> ((RTE_TIMESTAMP_SHIFT) - 1U)) & RTE_TIMESTAMP_MASK;
 #endif
     *data_packet = timestamp | 1U | (data.w32.bits31 << (32U - (uint32_t)(RTE_FMT_ID_BITS)));
+    RTE_MSG_OUTPUT(p_rtedbg->buffer, buf_index, 2U)
 }
 
 
@@ -214,26 +601,30 @@ RTE_OPTIM_SPEED void __rte_msg1(const uint32_t fmt_id, const rte_any32_t data1)
 
 RTE_OPTIM_SPEED void __rte_msg2(const uint32_t fmt_id, const rte_any32_t data1, const rte_any32_t data2)
 {
-    rtedbg_t *p_rtedbg = &g_rtedbg;
+    rtedbg_t *p_rtedbg = RTE_MSG_RTEDBG(fmt_id, 2U);
 
 #if RTE_DELAYED_TSTAMP_READ != 1
     uint32_t timestamp = (rte_get_timestamp() >> ((RTE_TIMESTAMP_SHIFT) - 1U)) & RTE_TIMESTAMP_MASK;
+    RTE_LONG_TIMESTAMP_CHECK(timestamp)
 #endif
 
-    if (RTE_MESSAGE_DISABLED(p_rtedbg->filter, fmt_id, 2U))
+    if (RTE_MESSAGE_SKIPPED(p_rtedbg->filter, fmt_id, 2U))
     {
         return;
     }
 
+    RTE_LONG_TIMESTAMP_PRECHECK()
     uint32_t buf_index;
     RTE_RESERVE_SPACE(p_rtedbg, buf_index, 3U);                             //lint !e717
+    RTE_TRIGGER_CHECK(fmt_id, 2U, buf_index, 3U)
+    RTE_COUNT_GROUP_WORDS(fmt_id, 2U, 3U)
 
     rte_pack_data_t data;                                                   //lint !e9018
     data.w32.bits31 = fmt_id;
 
     data.w32.data = RTE_PARAM(data1);
     data.w64 <<= 1U;
-    uint32_t *data_packet = &g_rtedbg.buffer[buf_index];
+    uint32_t *data_packet = &p_rtedbg->buffer[buf_index];
     *data_packet = data.w32.data;
     data_packet++;
 
@@ -247,6 +638,7 @@ RTE_OPTIM_SPEED void __rte_msg2(const uint32_t fmt_id, const rte_any32_t data1,
 #endif
     // The FMT word with timestamp is written as the last value after other values are already in the buffer
     *data_packet = timestamp | 1U | (data.w32.bits31 << (32U - (uint32_t)(RTE_FMT_ID_BITS)));
+    RTE_MSG_OUTPUT(p_rtedbg->buffer, buf_index, 3U)
 }
 
 
@@ -260,26 +652,30 @@ RTE_OPTIM_SPEED void __rte_msg2(const uint32_t fmt_id, const rte_any32_t data1,
 RTE_OPTIM_SPEED void __rte_msg3(const uint32_t fmt_id, const rte_any32_t data1,
                                 const rte_any32_t data2, const rte_any32_t data3)
 {
-    rtedbg_t *p_rtedbg = &g_rtedbg;
+    rtedbg_t *p_rtedbg = RTE_MSG_RTEDBG(fmt_id, 3U);
 
 #if RTE_DELAYED_TSTAMP_READ != 1
     uint32_t timestamp = (rte_get_timestamp() >> ((RTE_TIMESTAMP_SHIFT) - 1U)) & RTE_TIMESTAMP_MASK;
+    RTE_LONG_TIMESTAMP_CHECK(timestamp)
 #endif
 
-    if (RTE_MESSAGE_DISABLED(p_rtedbg->filter, fmt_id, 3U))
+    if (RTE_MESSAGE_SKIPPED(p_rtedbg->filter, fmt_id, 3U))
     {
         return;
     }
 
+    RTE_LONG_TIMESTAMP_PRECHECK()
     uint32_t buf_index;
     RTE_RESERVE_SPACE(p_rtedbg, buf_index, 4U);                             //lint !e717
+    RTE_TRIGGER_CHECK(fmt_id, 3U, buf_index, 4U)
+    RTE_COUNT_GROUP_WORDS(fmt_id, 3U, 4U)
 
     rte_pack_data_t data;                                                   //lint !e9018
     data.w32.bits31 = fmt_id;
 
     data.w32.data = RTE_PARAM(data1);
     data.w64 <<= 1U;    // The top bit of all data words are packed to the FMT word
-    uint32_t *data_packet = &g_rtedbg.buffer[buf_index];
+    uint32_t *data_packet = &p_rtedbg->buffer[buf_index];
     *data_packet = data.w32.data;
     data_packet++;
 
@@ -299,6 +695,7 @@ RTE_OPTIM_SPEED void __rte_msg3(const uint32_t fmt_id, const rte_any32_t data1,
 
     // The FMT word with timestamp is written as the last value after other values are already in the buffer
     *data_packet = timestamp | 1U | (data.w32.bits31 << (32U - (uint32_t)(RTE_FMT_ID_BITS)));
+    RTE_MSG_OUTPUT(p_rtedbg->buffer, buf_index, 4U)
 }
 
 
@@ -312,19 +709,23 @@ RTE_OPTIM_SPEED void __rte_msg3(const uint32_t fmt_id, const rte_any32_t data1,
 RTE_OPTIM_SPEED void __rte_msg4(const uint32_t fmt_id, const rte_any32_t data1, const rte_any32_t data2,
                                 const rte_any32_t data3, const rte_any32_t data4)
 {
-    rtedbg_t *p_rtedbg = &g_rtedbg;
+    rtedbg_t *p_rtedbg = RTE_MSG_RTEDBG(fmt_id, 4U);
 
 #if RTE_DELAYED_TSTAMP_READ != 1
     uint32_t timestamp = (rte_get_timestamp() >> ((RTE_TIMESTAMP_SHIFT) - 1U)) & RTE_TIMESTAMP_MASK;
+    RTE_LONG_TIMESTAMP_CHECK(timestamp)
 #endif
 
-    if (RTE_MESSAGE_DISABLED(p_rtedbg->filter, fmt_id, 4U))
+    if (RTE_MESSAGE_SKIPPED(p_rtedbg->filter, fmt_id, 4U))
     {
         return;
     }
 
+    RTE_LONG_TIMESTAMP_PRECHECK()
     uint32_t buf_index;
     RTE_RESERVE_SPACE(p_rtedbg, buf_index, 5U);                             //lint !e717
+    RTE_TRIGGER_CHECK(fmt_id, 4U, buf_index, 5U)
+    RTE_COUNT_GROUP_WORDS(fmt_id, 4U, 5U)
 
     rte_pack_data_t data;                                                   //lint !e9018
     data.w32.bits31 = fmt_id;
@@ -332,7 +733,7 @@ RTE_OPTIM_SPEED void __rte_msg4(const uint32_t fmt_id, const rte_any32_t data1,
     // Save data to the buffer
     data.w32.data = RTE_PARAM(data1);
     data.w64 <<= 1U;
-    uint32_t *data_packet = &g_rtedbg.buffer[buf_index];
+    uint32_t *data_packet = &p_rtedbg->buffer[buf_index];
     *data_packet = data.w32.data;
     data_packet++;
 
@@ -357,6 +758,7 @@ RTE_OPTIM_SPEED void __rte_msg4(const uint32_t fmt_id, const rte_any32_t data1,
 
     // The FMT word with timestamp is written as the last value after other values are already in the buffer
     *data_packet = timestamp | 1U | (data.w32.bits31 << (32U - (uint32_t)(RTE_FMT_ID_BITS)));
+    RTE_MSG_OUTPUT(p_rtedbg->buffer, buf_index, 5U)
 }
 
 #else // RTE_MINIMIZED_CODE_SIZE == 0
@@ -431,21 +833,23 @@ RTE_OPTIM_SIZE void __rte_msg4(const uint32_t fmt_id, const rte_any32_t data1, c
 RTE_OPTIM_LARGE void __rte_msgn(const uint32_t fmt_id,
                                 volatile const void *const address, const uint32_t data_length)
 {
-    rtedbg_t *p_rtedbg = &g_rtedbg;
+    rtedbg_t *p_rtedbg = RTE_MSG_RTEDBG(fmt_id, (RTE_MINIMIZED_CODE_SIZE != 0) ? 0U : 4U);
     volatile const uint32_t *addr = (volatile const uint32_t *)address;    //lint !e925 !e9079 !e9087
     uint32_t length = data_length;
 
 #if RTE_DELAYED_TSTAMP_READ != 1
     uint32_t timestamp = (rte_get_timestamp() >> ((RTE_TIMESTAMP_SHIFT) - 1U)) & RTE_TIMESTAMP_MASK;
+    RTE_LONG_TIMESTAMP_CHECK(timestamp)
 #endif
 
-    if (RTE_MESSAGE_DISABLED(p_rtedbg->filter, fmt_id, (RTE_MINIMIZED_CODE_SIZE != 0) ? 0U : 4U))   //lint !e948 !e944
+    if (RTE_MESSAGE_SKIPPED(p_rtedbg->filter, fmt_id, (RTE_MINIMIZED_CODE_SIZE != 0) ? 0U : 4U))   //lint !e948 !e944
     {
         return;     // Discard the message if not enabled
     }
 
     if (length > RTE_MAX_MSG_SIZE)
     {
+        RTE_COUNT_LOST(p_rtedbg, too_long_count);
 #if RTE_DISCARD_TOO_LONG_MESSAGES != 0
         return;
 #else
@@ -460,8 +864,13 @@ RTE_OPTIM_LARGE void __rte_msgn(const uint32_t fmt_id,
         no_words = 1U;
     }
 
+    RTE_LONG_TIMESTAMP_PRECHECK()
     uint32_t buf_index;
     RTE_RESERVE_SPACE(p_rtedbg, buf_index, no_words);                       //lint !e717
+    RTE_TRIGGER_CHECK(fmt_id, (RTE_MINIMIZED_CODE_SIZE != 0) ? 0U : 4U, buf_index, no_words)
+    RTE_COUNT_GROUP_WORDS(fmt_id, (RTE_MINIMIZED_CODE_SIZE != 0) ? 0U : 4U, no_words)
+    const uint32_t msg_index = buf_index;
+    const uint32_t msg_words = no_words;
 
 #if RTE_DELAYED_TSTAMP_READ != 0
     uint32_t timestamp = (rte_get_timestamp() >> ((RTE_TIMESTAMP_SHIFT) - 1U)) & RTE_TIMESTAMP_MASK;
@@ -475,7 +884,33 @@ RTE_OPTIM_LARGE void __rte_msgn(const uint32_t fmt_id,
     timestamp |= ((fmt_id << (32U - ((uint32_t)(RTE_FMT_ID_BITS) - 4U))) & fmt_mask) | 1U;
 #endif
 
-    do
+    // Full subpackets with four DATA words. Bit 31 of each DATA word is moved directly
+    // to its position in the FMT word. The same FMT word is produced in the minimized
+    // mode because a full subpacket contains no extended data bits.
+    while (no_words >= 5U)
+    {
+        uint32_t *data_packet = &p_rtedbg->buffer[buf_index];
+        uint32_t data1 = addr[0];
+        uint32_t data2 = addr[1];
+        uint32_t data3 = addr[2];
+        uint32_t data4 = addr[3];
+        addr += 4U;
+
+        data_packet[0] = data1 << 1U;
+        data_packet[1] = data2 << 1U;
+        data_packet[2] = data3 << 1U;
+        data_packet[3] = data4 << 1U;
+        uint32_t bits31 = ((data1 >> 31U) << 3U) | ((data2 >> 31U) << 2U)
+                        | ((data3 >> 31U) << 1U) | (data4 >> 31U);
+        data_packet[4] = timestamp | (bits31 << (32U - (uint32_t)(RTE_FMT_ID_BITS)));
+
+        buf_index += 5U;
+        RTE_LIMIT_INDEX(buf_index)
+        no_words -= 5U;
+    }
+
+    // The last subpacket with less than four DATA words (or no data)
+    if (no_words != 0U)
     {
         rte_pack_data_t data;                                               //lint !e9018
 #if RTE_MINIMIZED_CODE_SIZE != 0
@@ -485,7 +920,7 @@ RTE_OPTIM_LARGE void __rte_msgn(const uint32_t fmt_id,
 #endif
 
         // Store data in the reserved space in the circular buffer
-        uint32_t *data_packet = &g_rtedbg.buffer[buf_index];
+        uint32_t *data_packet = &p_rtedbg->buffer[buf_index];
         switch (no_words)
         {
             default:
@@ -495,13 +930,6 @@ RTE_OPTIM_LARGE void __rte_msgn(const uint32_t fmt_id,
                 *data_packet = data.w32.data;
                 data_packet++;
                 RTE_FALLTHROUGH; /* fallthrough */ //lint -fallthrough
-            case 4U:
-                data.w32.data = *addr;
-                addr++;
-                data.w64 <<= 1U;
-                *data_packet = data.w32.data;
-                data_packet++;
-                RTE_FALLTHROUGH; /* fallthrough */ //lint -fallthrough
             case 3U:
                 data.w32.data = *addr;
                 addr++;
@@ -528,42 +956,35 @@ RTE_OPTIM_LARGE void __rte_msgn(const uint32_t fmt_id,
 #endif
                 break;
         }
-
-        buf_index += 5U;
-        RTE_LIMIT_INDEX(buf_index)
-        no_words -= 5U;
     }
-    while ((int32_t)no_words > 0);
+
+    RTE_MSG_OUTPUT(p_rtedbg->buffer, msg_index, msg_words)
 }
 
 
 /********************************************************************************
- * @brief Log a message defined by address and size + timestamp/format ID.
- *        The maximum message length is either 255 bytes or (RTE_MAX_SUBPACKETS * 16) - 1
- *        bytes (whichever is less). The upper 8 bits of the last 32-bit data word
- *        written to the circular buffer define the message length (in bytes).
+ * @brief Write a message defined by address and size - see __rte_msgx().
+ *        Common part of __rte_msgx() and __rte_delta_msg(), which must know if
+ *        the message has been logged.
  *
  * @param fmt_id       Format ID number - see the description of __rte_msg0().
  * @param address      Start address of data
  * @param data_length  Data length (bytes)
- *
- * @note  This function allows you to log data whose length is not divisible by
- *        four and the length is unknown at compile time, or whose address does not
- *        need to be word aligned. The string type data also does not have to be
- *        null terminated. The data is read as bytes from the source address.
+ * @param logged       Set to 1 if the message has been written (NULL = not needed)
  ********************************************************************************/
 
-RTE_OPTIM_LARGE void __rte_msgx(const uint32_t fmt_id,
-                                volatile const void *const address, const uint32_t data_length)
+__STATIC_FORCEINLINE void rte_msgx_write(const uint32_t fmt_id, volatile const void *const address,
+                                         const uint32_t data_length, uint32_t * const logged)
 {
-    rtedbg_t *p_rtedbg = &g_rtedbg;
+    rtedbg_t *p_rtedbg = RTE_MSG_RTEDBG(fmt_id, 4U);
     uint32_t length = data_length;
 
 #if RTE_DELAYED_TSTAMP_READ != 1
     uint32_t timestamp = (rte_get_timestamp() >> ((RTE_TIMESTAMP_SHIFT) - 1U)) & RTE_TIMESTAMP_MASK;
+    RTE_LONG_TIMESTAMP_CHECK(timestamp)
 #endif
 
-    if (RTE_MESSAGE_DISABLED(p_rtedbg->filter, fmt_id, 4U))
+    if (RTE_MESSAGE_SKIPPED(p_rtedbg->filter, fmt_id, 4U))
     {
         return;
     }
@@ -571,6 +992,7 @@ RTE_OPTIM_LARGE void __rte_msgx(const uint32_t fmt_id,
     // Calculate the space required to copy the message to the circular buffer
     if (length > (RTE_MAX_MSGX_SIZE - 1U))
     {
+        RTE_COUNT_LOST(p_rtedbg, too_long_count);
 #if RTE_DISCARD_TOO_LONG_MESSAGES != 0
         return;
 #else
@@ -579,8 +1001,13 @@ RTE_OPTIM_LARGE void __rte_msgx(const uint32_t fmt_id,
     }
 
     uint32_t no_words = 2U + (length / 4U) + (length / 16U);
+    RTE_LONG_TIMESTAMP_PRECHECK()
     uint32_t buf_index;
     RTE_RESERVE_SPACE(p_rtedbg, buf_index, no_words);                       //lint !e717
+    RTE_TRIGGER_CHECK(fmt_id, 4U, buf_index, no_words)
+    RTE_COUNT_GROUP_WORDS(fmt_id, 4U, no_words)
+    const uint32_t msg_index = buf_index;
+    const uint32_t msg_words = no_words;
 
 #if RTE_DELAYED_TSTAMP_READ != 0
     uint32_t timestamp = (rte_get_timestamp() >> ((RTE_TIMESTAMP_SHIFT) - 1U)) & RTE_TIMESTAMP_MASK;
@@ -590,32 +1017,45 @@ RTE_OPTIM_LARGE void __rte_msgx(const uint32_t fmt_id,
     rte_pack_data_t data;                                                   //lint !e9018
     volatile const uint8_t *addr = (volatile const uint8_t *)address;      //lint !e925 !e9079
     int32_t remaining_bytes = (int32_t)length;
+#if RTE_MSGX_WORD_ACCESS != 0
+    // Complete words are copied from a word-aligned source (the byte order is the same)
+    const uint32_t word_access = (uint32_t)(((uintptr_t)address) & 3U);    //lint !e923
+#endif
 
     do
     {
         data.w32.bits31 = 0U;
         no_words = 4U;
-        uint32_t *data_packet = &g_rtedbg.buffer[buf_index];
+        uint32_t *data_packet = &p_rtedbg->buffer[buf_index];
 
         do
         {
-            data.w32.data = 0U;
-            switch (remaining_bytes)
+#if RTE_MSGX_WORD_ACCESS != 0
+            if ((word_access == 0U) && (remaining_bytes >= 4))
             {
-                default:
-                    data.w32.data = ((uint32_t)addr[3U]) << 24U;
-                    RTE_FALLTHROUGH; /* fallthrough */ //lint -fallthrough
-                case 3:
-                    data.w32.data |= ((uint32_t)addr[2U]) << 16U;
-                    RTE_FALLTHROUGH; /* fallthrough */ //lint -fallthrough
-                case 2:
-                    data.w32.data |= ((uint32_t)addr[1U]) << 8U;
-                    RTE_FALLTHROUGH; /* fallthrough */ //lint -fallthrough
-                case 1:
-                    data.w32.data |= (uint32_t)*addr;
-                    break;
-                case 0:
-                    break;
+                data.w32.data = *(volatile const uint32_t *)addr;          //lint !e927 !e826
+            }
+            else
+#endif
+            {
+                data.w32.data = 0U;
+                switch (remaining_bytes)
+                {
+                    default:
+                        data.w32.data = ((uint32_t)addr[3U]) << 24U;
+                        RTE_FALLTHROUGH; /* fallthrough */ //lint -fallthrough
+                    case 3:
+                        data.w32.data |= ((uint32_t)addr[2U]) << 16U;
+                        RTE_FALLTHROUGH; /* fallthrough */ //lint -fallthrough
+                    case 2:
+                        data.w32.data |= ((uint32_t)addr[1U]) << 8U;
+                        RTE_FALLTHROUGH; /* fallthrough */ //lint -fallthrough
+                    case 1:
+                        data.w32.data |= (uint32_t)*addr;
+                        break;
+                    case 0:
+                        break;
+                }
             }
 
             addr += 4U;                                                     //lint !e9016
@@ -640,75 +1080,756 @@ RTE_OPTIM_LARGE void __rte_msgx(const uint32_t fmt_id,
         RTE_LIMIT_INDEX(buf_index)
     }
     while (remaining_bytes >= 0);
+
+    RTE_MSG_OUTPUT(p_rtedbg->buffer, msg_index, msg_words)
+    if (logged != NULL)
+    {
+        *logged = 1U;
+    }
 }
 
 
 /********************************************************************************
- * @brief Write a string to the circular buffer. The maximum message length is
- *        limited by RTE_MAX_MSG_SIZE.
+ * @brief Log a message defined by address and size + timestamp/format ID.
+ *        The maximum message length is either 255 bytes or (RTE_MAX_SUBPACKETS * 16) - 1
+ *        bytes (whichever is less). The upper 8 bits of the last 32-bit data word
+ *        written to the circular buffer define the message length (in bytes).
  *
- * @param fmt_id   Format ID number - see the description of __rte_msg0().
- * @param address  String start address
+ * @param fmt_id       Format ID number - see the description of __rte_msg0().
+ * @param address      Start address of data
+ * @param data_length  Data length (bytes)
+ *
+ * @note  This function allows you to log data whose length is not divisible by
+ *        four and the length is unknown at compile time, or whose address does not
+ *        need to be word aligned. The string type data also does not have to be
+ *        null terminated. The data is read as bytes from the source address.
  ********************************************************************************/
 
-RTE_OPTIM_SIZE void __rte_string(const uint32_t fmt_id, const char * const address)
+RTE_OPTIM_LARGE void __rte_msgx(const uint32_t fmt_id,
+                                volatile const void *const address, const uint32_t data_length)
 {
-    __rte_stringn(fmt_id, address, RTE_MAX_MSG_SIZE);
+    rte_msgx_write(fmt_id, address, data_length, NULL);
 }
 
 
 /********************************************************************************
- * @brief Write a string to the circular buffer. The maximum message length is limited
- *        by RTE_MAX_MSG_SIZE. If the length of the string (excluding the trailing
- *        null byte) is divisible by 4, the null byte at the end of the string is not
- *        saved to the buffer.
+ * @brief Log an array of 32-bit values as differences to the previously logged
+ *        values. The differences are encoded as variable length numbers, so a slowly
+ *        changing array (e.g. sampled sensor data) takes only a few bytes per element.
+ *        The encoded data is logged with __rte_msgx() (byte array message).
  *
- * @param fmt_id      Format ID number - see the description of __rte_msg0().
- * @param address     String start address
- * @param max_length  Maximum message length to be stored in the circular buffer
+ * @param fmt_id  Format ID number - see the description of __rte_msgx().
+ * @param ctx     Context of the logged array
+ * @param data    Array with ctx->count 32-bit values
+ *
+ * Encoding (must be decoded by the host software from the MSGX message data):
+ *   Byte 0    - frame type: 0 = keyframe (differences to zero), 1 = delta frame
+ *               (differences to the values of the previous frame)
+ *   Byte 1... - one value per array element: diff = value - previous (modulo 2^32),
+ *               zigzag encoded: z = (diff << 1) ^ (diff >> 31 arithmetic), stored
+ *               as an unsigned LEB128 number (7 bits per byte, least significant
+ *               group first, bit 7 set in all bytes except the last one).
+ *
+ * The frame type is stored in the first data byte instead of an FMT word flag.
+ * All FMT word bits are used by the timestamp, format ID and bit 31 of the DATA
+ * words, and the message remains an ordinary MSGX message for RTEmsg.
+ *
+ * @note  The previous values are updated only if the message has been written to
+ *        the circular buffer. If it has not been logged (message filter, too long
+ *        encoded data, single shot buffer full, streaming overrun, trigger, etc.),
+ *        the next message is encoded against the last logged frame. Use a keyframe
+ *        interval so that the host can continue decoding after a logged message was
+ *        lost (e.g. overwritten). The function is not reentrant for the same context.
+ *
+ * @note  The data is encoded in a RTE_MAX_MSGX_SIZE - 1 byte (max. 254 bytes) array
+ *        on the stack - take it into account when the function is called from
+ *        an interrupt routine.
  ********************************************************************************/
 
-RTE_OPTIM_SPEED void __rte_stringn(const uint32_t fmt_id,
-                                   const char * const address, const uint32_t max_length)
+RTE_OPTIM_SPEED void __rte_delta_msg(const uint32_t fmt_id, rte_delta_ctx_t * const ctx,
+                                     const uint32_t * const data)
 {
-    uint32_t length = max_length;
-    if (RTE_MAX_MSG_SIZE < length)
+    if (RTE_MESSAGE_DISABLED(RTE_MSG_RTEDBG(fmt_id, 4U)->filter, fmt_id, 4U))
     {
-        length = RTE_MAX_MSG_SIZE;  // Limit the size to the maximum possible
+        return;     // Do not encode the data if the message is not enabled
     }
 
-    const char *s = address;
-    uint32_t len;
-    for (len = 0U; (*s != '\0') && (len < length); len++)
+    uint8_t encoded[RTE_MAX_MSGX_SIZE - 1U];
+    const uint32_t keyframe = (ctx->frame_counter == 0U) ? 1U : 0U;
+    uint32_t length = 1U;
+    encoded[0] = (keyframe != 0U) ? 0U : 1U;
+
+    for (uint32_t i = 0U; i < ctx->count; i++)
     {
-        s++;
-    }
+        uint32_t diff = data[i] - ((keyframe != 0U) ? 0U : ctx->previous[i]);
+        uint32_t zigzag = (diff << 1U) ^ (0U - (diff >> 31U));
 
-    __rte_msgn(fmt_id, address, len);
-}
+        do
+        {
+            if (length >= (RTE_MAX_MSGX_SIZE - 1U))
+            {
+                RTE_COUNT_LOST(RTE_MSG_RTEDBG(fmt_id, 4U), too_long_count);
+                return;     // Encoded data too long - the message is not logged
+            }
+            encoded[length] = (uint8_t)(zigzag & 0x7FU);
+            zigzag >>= 7U;
+            if (zigzag != 0U)
+            {
+                encoded[length] |= 0x80U;
+            }
+            length++;
+        }
+        while (zigzag != 0U);
+    }
+
+    uint32_t logged = 0U;
+    rte_msgx_write(fmt_id, encoded, length, &logged);
+    if (logged == 0U)
+    {
+        return;     // Not logged - the host still has the previous frame as the reference
+    }
+
+    for (uint32_t i = 0U; i < ctx->count; i++)
+    {
+        ctx->previous[i] = data[i];
+    }
+
+    ctx->frame_counter++;
+    if (ctx->frame_counter >= ctx->keyframe_interval)
+    {
+        ctx->frame_counter = (ctx->keyframe_interval == 0U) ? 1U : 0U;
+    }
+}
+
+
+/********************************************************************************
+ * @brief Reserve the circular buffer space for a message with 'data_words' DATA
+ *        words (zero-copy logging). The caller or e.g. a streaming encoder writes
+ *        the DATA words directly to the circular buffer with rte_reserved_write()
+ *        and then calls rte_commit(). The message is decoded as a __rte_msgn()
+ *        message logged at the time of the reservation.
+ *        The FMT words are marked as not yet written (erased state) - the RTEmsg
+ *        decoding software and rte_stream_read() detect a message that has not
+ *        been committed.
+ *
+ * @param fmt_id      Format ID number - see the description of __rte_msgn().
+ * @param res         Reservation data for rte_reserved_write() and rte_commit()
+ * @param data_words  Number of DATA words (max. RTE_MAX_MSG_SIZE / 4)
+ *
+ * @note  res->buffer is NULL if the message has been discarded (message filter, too
+ *        long message or not enough space in the single shot or streaming mode).
+ *        Check it with RTE_RESERVED(res) before the data is written.
+ ********************************************************************************/
+
+RTE_OPTIM_SPEED void __rte_reserve(const uint32_t fmt_id, rte_reservation_t * const res,
+                                   const uint32_t data_words)
+{
+    rtedbg_t *p_rtedbg = RTE_MSG_RTEDBG(fmt_id, (RTE_MINIMIZED_CODE_SIZE != 0) ? 0U : 4U);
+    res->buffer = NULL;
+
+#if RTE_DELAYED_TSTAMP_READ != 1
+    uint32_t timestamp = (rte_get_timestamp() >> ((RTE_TIMESTAMP_SHIFT) - 1U)) & RTE_TIMESTAMP_MASK;
+    RTE_LONG_TIMESTAMP_CHECK(timestamp)
+#endif
+
+    if (RTE_MESSAGE_SKIPPED(p_rtedbg->filter, fmt_id, (RTE_MINIMIZED_CODE_SIZE != 0) ? 0U : 4U))   //lint !e948 !e944
+    {
+        return;     // Discard the message if not enabled
+    }
+
+    if (data_words > (RTE_MAX_MSG_SIZE / 4U))
+    {
+        RTE_COUNT_LOST(p_rtedbg, too_long_count);
+        return;     // The caller cannot write less data than requested
+    }
+
+    // Add one FMT word for every four DATA words (one FMT word if there is no data)
+    uint32_t no_words = data_words + ((data_words + 3U) / 4U);
+    if (no_words == 0U)
+    {
+        no_words = 1U;
+    }
+
+    RTE_LONG_TIMESTAMP_PRECHECK()
+    uint32_t buf_index;
+    RTE_RESERVE_SPACE(p_rtedbg, buf_index, no_words);                       //lint !e717
+    RTE_TRIGGER_CHECK(fmt_id, (RTE_MINIMIZED_CODE_SIZE != 0) ? 0U : 4U, buf_index, no_words)
+    RTE_COUNT_GROUP_WORDS(fmt_id, (RTE_MINIMIZED_CODE_SIZE != 0) ? 0U : 4U, no_words)
+
+#if RTE_DELAYED_TSTAMP_READ != 0
+    uint32_t timestamp = (rte_get_timestamp() >> ((RTE_TIMESTAMP_SHIFT) - 1U)) & RTE_TIMESTAMP_MASK;
+#endif
+
+#if RTE_MINIMIZED_CODE_SIZE != 0
+    const unsigned fmt_mask = ((1U << ((uint32_t)(RTE_FMT_ID_BITS) - 4U)) - 1U) << 4U;
+    timestamp |= ((fmt_id & fmt_mask) << (32U - (uint32_t)(RTE_FMT_ID_BITS))) | 1U;
+#else
+    const unsigned fmt_mask = ((1U << ((uint32_t)(RTE_FMT_ID_BITS) - 4U)) - 1U) << (32U - ((uint32_t)(RTE_FMT_ID_BITS) - 4U));
+    timestamp |= ((fmt_id << (32U - ((uint32_t)(RTE_FMT_ID_BITS) - 4U))) & fmt_mask) | 1U;
+#endif
+
+    // Mark the FMT words of all subpackets as not written yet
+    uint32_t index = buf_index;
+    uint32_t words = data_words;
+    while (words > 4U)
+    {
+        p_rtedbg->buffer[index + 4U] = RTE_ERASED_STATE;
+        words -= 4U;
+        index += 5U;
+        RTE_LIMIT_INDEX(index)
+    }
+    p_rtedbg->buffer[index + words] = RTE_ERASED_STATE;
+
+    res->bits31[0] = 0U;    // Also used if there are no DATA words
+    for (uint32_t i = 1U; i < ((data_words + 31U) / 32U); i++)
+    {
+        res->bits31[i] = 0U;
+    }
+
+    res->index = buf_index;
+    res->words = data_words;
+    res->fmt_word = timestamp;
+    res->buffer = &p_rtedbg->buffer[0];
+}
+
+
+/********************************************************************************
+ * @brief Write a DATA word of the reserved message to the circular buffer.
+ *        The word is stored shifted left by one bit as in __rte_msgn() - bit 0 of
+ *        a DATA word is never set, so the streaming functions do not mistake it for
+ *        an FMT word. Bit 31 is kept in the reservation until rte_commit().
+ *
+ * @param res    Reservation made with RTE_RESERVE()
+ * @param n      Number of the DATA word (0 ... data_words - 1)
+ * @param value  Any 32-bit data
+ *
+ * @note  The words can be written in any order. Write each word only once.
+ ********************************************************************************/
+
+RTE_OPTIM_SPEED void rte_reserved_write(rte_reservation_t * const res, const uint32_t n,
+                                        const uint32_t value)
+{
+    const uint32_t subpacket = n / 4U;
+    uint32_t index = res->index + (subpacket * 5U);
+
+#if RTE_BUFF_SIZE_IS_POWER_OF_2 != 0
+    index &= (uint32_t)(RTE_BUFFER_SIZE) - 1U;
+#else
+    if (index >= (uint32_t)(RTE_BUFFER_SIZE))
+    {
+        // The subpackets after the end of the buffer continue at index 0 - see RTE_LIMIT_INDEX()
+        const uint32_t first_wrapped = (((uint32_t)(RTE_BUFFER_SIZE) - res->index) + 4U) / 5U;
+        index = (subpacket - first_wrapped) * 5U;
+    }
+#endif
+
+    res->buffer[index + (n % 4U)] = value << 1U;
+
+    // Bit 31 of the first DATA word of a subpacket is the highest of its FMT word bits
+    const uint32_t remaining = res->words - (subpacket * 4U);
+    const uint32_t count = (remaining > 4U) ? 4U : remaining;   // DATA words of this subpacket
+    res->bits31[subpacket / 8U] |=
+        (value >> 31U) << (((subpacket % 8U) * 4U) + (count - 1U - (n % 4U)));
+}
+
+
+/********************************************************************************
+ * @brief Complete the message reserved with RTE_RESERVE() after all DATA words have
+ *        been written. The FMT word of each subpacket is written after its DATA
+ *        words - as in __rte_msgn().
+ *
+ * @param res  Reservation made with RTE_RESERVE() - nothing is done if the message
+ *             has been discarded
+ *
+ * @note  Call the function only once for each reservation. A snapshot of the buffer
+ *        taken before the message has been committed may contain partially written
+ *        data in the reserved space.
+ ********************************************************************************/
+
+RTE_OPTIM_SPEED void rte_commit(const rte_reservation_t * const res)
+{
+    uint32_t * const buffer = res->buffer;
+    if (buffer == NULL)
+    {
+        return;
+    }
+
+    uint32_t buf_index = res->index;
+    uint32_t words = res->words;
+    uint32_t subpacket = 0U;
+
+    do
+    {
+        const uint32_t count = (words > 4U) ? 4U : words;  // DATA words of this subpacket
+        const uint32_t bits31 = (res->bits31[subpacket / 8U] >> ((subpacket % 8U) * 4U)) & 0x0FU;
+        buffer[buf_index + count] = res->fmt_word | (bits31 << (32U - (uint32_t)(RTE_FMT_ID_BITS)));
+        words -= count;
+        subpacket++;
+        buf_index += 5U;
+        RTE_LIMIT_INDEX(buf_index)
+    }
+    while (words != 0U);
+
+    RTE_MSG_OUTPUT(buffer, res->index,
+                   (res->words == 0U) ? 1U : (res->words + ((res->words + 3U) / 4U)))
+}
+
+
+/********************************************************************************
+ * @brief Write a string to the circular buffer. The maximum message length is
+ *        limited by RTE_MAX_MSG_SIZE.
+ *
+ * @param fmt_id   Format ID number - see the description of __rte_msg0().
+ * @param address  String start address
+ ********************************************************************************/
+
+RTE_OPTIM_SIZE void __rte_string(const uint32_t fmt_id, const char * const address)
+{
+    __rte_stringn(fmt_id, address, RTE_MAX_MSG_SIZE);
+}
+
+
+/********************************************************************************
+ * @brief Write a string to the circular buffer. The maximum message length is limited
+ *        by RTE_MAX_MSG_SIZE. If the length of the string (excluding the trailing
+ *        null byte) is divisible by 4, the null byte at the end of the string is not
+ *        saved to the buffer.
+ *
+ * @param fmt_id      Format ID number - see the description of __rte_msg0().
+ * @param address     String start address
+ * @param max_length  Maximum message length to be stored in the circular buffer
+ *
+ * @note  A word-aligned string is checked for the null byte four bytes at a time.
+ *        The string length must be known before the space in the circular buffer
+ *        can be reserved. Strings with a maximum length of up to RTE_STRING_WINDOW_SIZE
+ *        bytes are copied to a window on the stack during the search and logged from
+ *        there, so they are read only once. Longer strings are read twice (the second
+ *        time as complete words by __rte_msgn()).
+ ********************************************************************************/
+
+RTE_OPTIM_SPEED void __rte_stringn(const uint32_t fmt_id,
+                                   const char * const address, const uint32_t max_length)
+{
+    if (RTE_MESSAGE_DISABLED(RTE_MSG_RTEDBG(fmt_id, (RTE_MINIMIZED_CODE_SIZE != 0) ? 0U : 4U)->filter,
+                             fmt_id, (RTE_MINIMIZED_CODE_SIZE != 0) ? 0U : 4U))            //lint !e948 !e944
+    {
+        return;     // The string is not searched if the message is not enabled
+    }
+
+    uint32_t length = max_length;
+    if (RTE_MAX_MSG_SIZE < length)
+    {
+        length = RTE_MAX_MSG_SIZE;  // Limit the size to the maximum possible
+    }
+
+    if (length <= RTE_STRING_WINDOW_SIZE)
+    {
+        uint32_t window[RTE_STRING_WINDOW_SIZE / 4U];
+        uint8_t *dst = (uint8_t *)window;                                   //lint !e928
+        const char *s = address;
+        uint32_t len = 0U;
+
+        if ((((uintptr_t)s) & 3U) == 0U)                                    //lint !e923
+        {
+            // Copy the complete words without a null byte
+            while ((len + 4U) <= length)
+            {
+                uint32_t word = *(volatile const uint32_t *)&s[len];        //lint !e927 !e826
+                if (((word - 0x01010101U) & ~word & 0x80808080U) != 0U)
+                {
+                    break;      // One of the bytes is zero
+                }
+                window[len / 4U] = word;
+                len += 4U;
+            }
+        }
+
+        for (; (len < length) && (s[len] != '\0'); len++)
+        {
+            dst[len] = (uint8_t)s[len];
+        }
+
+        for (uint32_t i = len; (i & 3U) != 0U; i++)
+        {
+            dst[i] = 0U;    // Bytes after the end of the string in the last DATA word
+        }
+
+        __rte_msgn(fmt_id, window, len);
+        return;
+    }
+
+    const char *s = address;
+    uint32_t len = 0U;
+
+    if ((((uintptr_t)s) & 3U) == 0U)                                        //lint !e923
+    {
+        // Skip the complete words without a null byte
+        while ((len + 4U) <= length)
+        {
+            uint32_t word = *(volatile const uint32_t *)s;                  //lint !e927 !e826
+            if (((word - 0x01010101U) & ~word & 0x80808080U) != 0U)
+            {
+                break;      // One of the bytes is zero
+            }
+            s += 4U;                                                        //lint !e9016
+            len += 4U;
+        }
+    }
+
+    for (; (*s != '\0') && (len < length); len++)
+    {
+        s++;
+    }
+
+    __rte_msgn(fmt_id, address, len);
+}
+
+
+/********************************************************************************
+ * @brief Log several short messages with a single buffer space reservation and
+ *        timestamp read. The filter is checked for each message and only the
+ *        enabled messages are written to the circular buffer - each one as a
+ *        separate subpacket. All messages get the same timestamp value.
+ *
+ * @param msgs   Array of message descriptions - see the RTE_BATCH_MSG0() ...
+ *               RTE_BATCH_MSG4() macros.
+ * @param count  Number of messages in the array (max. RTE_MAX_BATCH_MESSAGES).
+ *               Nothing is logged and the msgs array is not accessed if it is 0.
+ *
+ * @note  If the count is larger than RTE_MAX_BATCH_MESSAGES, the batch is either
+ *        discarded or only the first RTE_MAX_BATCH_MESSAGES messages are logged
+ *        (depending on the RTE_DISCARD_TOO_LONG_MESSAGES setting).
+ *
+ * @note  If RTE_CHANNELS > 1, the whole batch is logged to the channel of the first
+ *        message and the filter of that channel is checked for all of them.
+ ********************************************************************************/
+
+RTE_OPTIM_SPEED void __rte_msg_batch(const rte_batch_msg_t * const msgs, const uint32_t count)
+{
+    if (count == 0U)
+    {
+        return;     // Empty batch - the msgs[0] must not be accessed
+    }
+
+    rtedbg_t *p_rtedbg = RTE_MSG_RTEDBG(msgs[0].fmt_id, 0U);
+    uint32_t no_msgs = count;
+
+#if RTE_DELAYED_TSTAMP_READ != 1
+    uint32_t timestamp = (rte_get_timestamp() >> ((RTE_TIMESTAMP_SHIFT) - 1U)) & RTE_TIMESTAMP_MASK;
+    RTE_LONG_TIMESTAMP_CHECK(timestamp)
+#endif
+
+    if (no_msgs > RTE_MAX_BATCH_MESSAGES)
+    {
+        RTE_COUNT_LOST(p_rtedbg, too_long_count);
+#if RTE_DISCARD_TOO_LONG_MESSAGES != 0
+        return;
+#else
+        no_msgs = RTE_MAX_BATCH_MESSAGES;
+#endif
+    }
+
+    // Check the filter for all messages and calculate the space required
+    uint32_t filter = p_rtedbg->filter;
+    uint32_t enabled = 0U;      // Bit n set = message #n enabled
+    uint32_t no_words = 0U;
+
+    for (uint32_t i = 0U; i < no_msgs; i++)
+    {
+        if (!RTE_MESSAGE_SKIPPED(filter, msgs[i].fmt_id, 0U))
+        {
+            uint32_t size = (msgs[i].size > 4U) ? 4U : msgs[i].size;
+            enabled |= 1UL << i;
+            no_words += size + 1U;
+        }
+    }
+
+    if (no_words == 0U)
+    {
+        return;     // All messages are disabled
+    }
+
+    RTE_LONG_TIMESTAMP_PRECHECK()
+    uint32_t buf_index;
+    RTE_RESERVE_SPACE(p_rtedbg, buf_index, no_words);                       //lint !e717
+    const uint32_t msg_index = buf_index;
+
+#if RTE_DELAYED_TSTAMP_READ != 0
+    uint32_t timestamp = (rte_get_timestamp() >> ((RTE_TIMESTAMP_SHIFT) - 1U)) & RTE_TIMESTAMP_MASK;
+#endif
+    timestamp |= 1U;
+
+    for (uint32_t i = 0U; enabled != 0U; i++, enabled >>= 1U)
+    {
+        if ((enabled & 1U) == 0U)
+        {
+            continue;
+        }
+
+        uint32_t size = (msgs[i].size > 4U) ? 4U : msgs[i].size;
+        const uint32_t *src = &msgs[i].data[0];
+        uint32_t *data_packet = &p_rtedbg->buffer[buf_index];
+        rte_pack_data_t data;                                               //lint !e9018
+        data.w32.bits31 = msgs[i].fmt_id >> size;   // Make space for bit 31 of the DATA words
+
+        for (uint32_t j = 0U; j < size; j++)
+        {
+            data.w32.data = *src;
+            src++;
+            data.w64 <<= 1U;
+            *data_packet = data.w32.data;
+            data_packet++;
+        }
+
+        // The FMT word with timestamp is written as the last value of the subpacket
+        *data_packet = timestamp | (data.w32.bits31 << (32U - (uint32_t)(RTE_FMT_ID_BITS)));
+
+        RTE_TRIGGER_CHECK(msgs[i].fmt_id, 0U, buf_index, size + 1U)
+        RTE_COUNT_GROUP_WORDS(msgs[i].fmt_id, 0U, size + 1U)
+        buf_index += size + 1U;
+        RTE_LIMIT_INDEX(buf_index)
+    }
+
+    RTE_MSG_OUTPUT(p_rtedbg->buffer, msg_index, no_words)
+}
+
+
+#if RTE_STREAMING_ENABLED != 0
+
+/********************************************************************************
+ * @brief Get the length of a completely written subpacket. The FMT word is the
+ *        last word written to a subpacket, and it is the only one with bit 0 set.
+ *
+ * @param  p_rtedbg  Pointer to the data logging structure
+ * @param  index     Index of the first word of the subpacket
+ *
+ * @return Number of subpacket words (1 ... 5) or 0 if the subpacket has been reserved
+ *         but not yet completely written (a message that is still being logged by an
+ *         interrupted task).
+ ********************************************************************************/
+
+RTE_OPTIM_SPEED static uint32_t rte_subpacket_length(const rtedbg_t * const p_rtedbg, const uint32_t index)
+{
+    uint32_t length = 0U;
+    uint32_t word;
+
+    do
+    {
+        word = p_rtedbg->buffer[index + length];
+        if (word == RTE_ERASED_STATE)
+        {
+            return 0U;
+        }
+        length++;
+    }
+    while (((word & 1U) == 0U) && (length < 5U));
+
+    return length;
+}
+
+
+/********************************************************************************
+ * @brief Copy the messages logged since the last call of this function to the
+ *        destination buffer and release the space in the circular buffer.
+ *        Only complete subpackets are copied, i.e. those with the FMT word already
+ *        written. The function returns as soon as it finds a subpacket that has
+ *        been reserved but not yet written or when the next subpacket would not fit
+ *        into the destination buffer. The copied words are erased to RTE_ERASED_STATE.
+ *        The data is copied in the same format as it is in the circular buffer.
+ *        The subpackets that wrap at the end of the circular buffer (four word trailer)
+ *        are copied as a whole.
+ *
+ * @param  dst        Destination buffer address
+ * @param  max_words  Size of the destination buffer (number of 32-bit words)
+ *
+ * @return Number of words copied to the destination buffer.
+ *
+ * @note  The rte_stream_read() and rte_stream_get_block() / rte_stream_release()
+ *        functions are not reentrant. Use them from only one task - e.g. from a low
+ *        priority task that transfers the data to the host over UART, USB etc.
+ *        If RTE_SMP_CORES > 1, the buffer of the calling CPU core is read.
+ ********************************************************************************/
+
+RTE_OPTIM_SPEED uint32_t rte_stream_read(uint32_t * const dst, const uint32_t max_words)
+{
+    rtedbg_t *p_rtedbg = RTE_LOCAL_RTEDBG();
+    uint32_t rd_index = p_rtedbg->rd_index;
+    uint32_t wr_index = p_rtedbg->buf_index;
+    RTE_LIMIT_INDEX(wr_index)
+    RTE_DATA_MEMORY_BARRIER();      // Read the buffer after the index
+    uint32_t copied = 0U;
+
+    while (rd_index != wr_index)
+    {
+        uint32_t length = rte_subpacket_length(p_rtedbg, rd_index);
+        if ((length == 0U) || ((copied + length) > max_words))
+        {
+            break;
+        }
+
+        // Copy the complete subpacket and release the space
+        for (uint32_t i = 0U; i < length; i++)
+        {
+            dst[copied] = p_rtedbg->buffer[rd_index + i];
+            copied++;
+            p_rtedbg->buffer[rd_index + i] = RTE_ERASED_STATE;
+        }
+
+        rd_index += length;
+        RTE_LIMIT_INDEX(rd_index)
+    }
+
+    RTE_DATA_MEMORY_BARRIER();      // Erase the data before the space is released
+    p_rtedbg->rd_index = rd_index;
+    return copied;
+}
+
+
+/********************************************************************************
+ * @brief Get the address and size of a block of complete subpackets that can be
+ *        transferred directly from the circular buffer (without copying) - e.g. with
+ *        a DMA channel. The block starts at rd_index and ends with the first subpacket
+ *        that reaches the middle or the end of the circular buffer. The subpackets are
+ *        not aligned to the middle, so the last one may extend up to four words past it.
+ *        Only the subpackets that wrap at the end of the buffer extend into the four
+ *        word trailer.
+ *        Call rte_stream_release() after the block has been transferred.
+ *
+ * @param  address  Pointer to the variable for the start address of the block
+ *
+ * @return Number of words in the block (0 = no complete subpackets available).
+ ********************************************************************************/
+
+RTE_OPTIM_SPEED uint32_t rte_stream_get_block(uint32_t ** const address)
+{
+    rtedbg_t *p_rtedbg = RTE_LOCAL_RTEDBG();
+    uint32_t rd_index = p_rtedbg->rd_index;
+    uint32_t wr_index = p_rtedbg->buf_index;
+    RTE_LIMIT_INDEX(wr_index)
+    RTE_DATA_MEMORY_BARRIER();      // Read the buffer after the index
+
+    // The block ends at the first subpacket boundary at or after the middle or the end
+    // of the buffer (half/full region). A subpacket that crosses the middle cannot be
+    // left out - the next block would then be empty.
+    uint32_t end = (rd_index < ((uint32_t)(RTE_BUFFER_SIZE) / 2U)) ?
+        ((uint32_t)(RTE_BUFFER_SIZE) / 2U) : (uint32_t)(RTE_BUFFER_SIZE);
+    uint32_t index = rd_index;
+
+    while ((index != wr_index) && (index < end))
+    {
+        uint32_t length = rte_subpacket_length(p_rtedbg, index);
+        if (length == 0U)
+        {
+            break;
+        }
+        index += length;
+    }
+
+    *address = &p_rtedbg->buffer[rd_index];
+    return index - rd_index;
+}
+
+
+/********************************************************************************
+ * @brief Release the space of a block that has been transferred to the host.
+ *        The block words are erased to RTE_ERASED_STATE.
+ *
+ * @param  length  Number of words returned by the rte_stream_get_block()
+ ********************************************************************************/
+
+RTE_OPTIM_SPEED void rte_stream_release(const uint32_t length)
+{
+    rtedbg_t *p_rtedbg = RTE_LOCAL_RTEDBG();
+    uint32_t rd_index = p_rtedbg->rd_index;
+
+    for (uint32_t i = 0U; i < length; i++)
+    {
+        p_rtedbg->buffer[rd_index + i] = RTE_ERASED_STATE;
+    }
+
+    rd_index += length;
+    RTE_LIMIT_INDEX(rd_index)
+    RTE_DATA_MEMORY_BARRIER();      // Erase the data before the space is released
+    p_rtedbg->rd_index = rd_index;
+}
+
+
+#if RTE_STREAM_DMA_ENABLED != 0
+
+static volatile uint32_t rte_dma_length;    //!< Number of words in the active DMA transfer (0 = none)
+
+/********************************************************************************
+ * @brief Start the DMA transfer of the next block of complete subpackets if the
+ *        DMA channel is not busy. Call this function periodically - e.g. from a
+ *        low priority task or timer interrupt. The transfers are started directly
+ *        from the circular buffer with the RTE_STREAM_DMA_START() macro.
+ ********************************************************************************/
+
+RTE_OPTIM_SIZE void rte_stream_dma_poll(void)
+{
+    if (rte_dma_length == 0U)   // The transfer complete interrupt can only occur if != 0
+    {
+        uint32_t *address;
+        uint32_t length = rte_stream_get_block(&address);
+        if (length != 0U)
+        {
+            rte_dma_length = length;
+            RTE_STREAM_DMA_START(address, length);
+        }
+    }
+}
+
+
+/********************************************************************************
+ * @brief Release the transferred block and start the next transfer if complete
+ *        subpackets are available. Call this function from the DMA transfer
+ *        complete interrupt. The RTE_STREAM_HALF_CALLBACK() and RTE_STREAM_FULL_CALLBACK()
+ *        macros are executed when the first or the second half of the circular
+ *        buffer has been transferred.
+ ********************************************************************************/
+
+RTE_OPTIM_SIZE void rte_stream_dma_complete(void)
+{
+    uint32_t old_index = RTE_LOCAL_RTEDBG()->rd_index;
+    rte_stream_release(rte_dma_length);
+    rte_dma_length = 0U;
+    uint32_t new_index = RTE_LOCAL_RTEDBG()->rd_index;
+
+    if (new_index < old_index)
+    {
+        RTE_STREAM_FULL_CALLBACK();     // Wrapped at the end of the buffer
+    }
+    else if ((old_index < ((uint32_t)(RTE_BUFFER_SIZE) / 2U))
+             && (new_index >= ((uint32_t)(RTE_BUFFER_SIZE) / 2U)))
+    {
+        RTE_STREAM_HALF_CALLBACK();     // The middle of the buffer has been reached
+    }
+    else
+    {
+        // Still in the same half of the buffer
+    }
+
+    rte_stream_dma_poll();
+}
+#endif // RTE_STREAM_DMA_ENABLED != 0
+#endif // RTE_STREAMING_ENABLED != 0
 
 
 #if RTE_FIRMWARE_MAY_SET_FILTER != 0
 
 /********************************************************************************
- * @brief Set the filter mask to enable/disable up to 32 message groups simultaneously.
- *        To completely disable data logging, set the filter value to zero. If simple
- *        re-enable is disabled with RTE_FILTER_OFF_ENABLED = 1, the filter must
- *        be re-enabled with a filter value of RTE_FORCE_ENABLE_ALL_FILTERS before proceeding.
- *        RTE_FORCE_ENABLE_ALL_FILTERS enables the logging of all messages by setting the
- *        filter variable to 0xFFFFFFFF. Once the filter is re-enabled (i.e., is no
- *        longer zero), any filter value can be set by calling this function.
- *        Filter number 0 (bit 31) can only be disabled by the filter parameter to 0.
+ * @brief Set the filter value of one data logging structure - see rte_set_filter().
  *
- * @param  filter  New message filter value
+ * @param  p_rtedbg  Data logging structure (CPU core or logging channel)
+ * @param  filter    New message filter value
  ********************************************************************************/
 
-RTE_OPTIM_SIZE void rte_set_filter(const uint32_t filter)
+RTE_OPTIM_SIZE static void rte_set_rtedbg_filter(rtedbg_t * const p_rtedbg, const uint32_t filter)
 {
     uint32_t new_value = filter;
 #if RTE_FILTER_OFF_ENABLED != 0
     RTE_DATA_MEMORY_BARRIER();          // Ensure visibility of changes across all CPU cores.
-    if (g_rtedbg.filter == 0U)          // Are message filters completely disabled?
+    if (p_rtedbg->filter == 0U)         // Are message filters completely disabled?
     {
         if (new_value != RTE_FORCE_ENABLE_ALL_FILTERS) // Enable even if completely disabled?
         {
@@ -721,14 +1842,59 @@ RTE_OPTIM_SIZE void rte_set_filter(const uint32_t filter)
     {
         // Filter #0 cannot be disabled unless all other filters are also disabled.
         new_value |= ~(uint32_t)RTE_FORCE_ENABLE_ALL_FILTERS;
-        g_rtedbg.filter_copy = new_value;   // Store the last non-zero filter value
+        p_rtedbg->filter_copy = new_value;  // Store the last non-zero filter value
     }
 
-    g_rtedbg.filter = new_value;
+    p_rtedbg->filter = new_value;
+}
+
+
+/********************************************************************************
+ * @brief Set the filter mask to enable/disable up to 32 message groups simultaneously.
+ *        To completely disable data logging, set the filter value to zero. If simple
+ *        re-enable is disabled with RTE_FILTER_OFF_ENABLED = 1, the filter must
+ *        be re-enabled with a filter value of RTE_FORCE_ENABLE_ALL_FILTERS before proceeding.
+ *        RTE_FORCE_ENABLE_ALL_FILTERS enables the logging of all messages by setting the
+ *        filter variable to 0xFFFFFFFF. Once the filter is re-enabled (i.e., is no
+ *        longer zero), any filter value can be set by calling this function.
+ *        Filter number 0 (bit 31) can only be disabled by the filter parameter to 0.
+ *        If RTE_SMP_CORES > 1, the filter value is set for all CPU cores.
+ *        If RTE_CHANNELS > 1, the filter value is set for all logging channels.
+ *
+ * @param  filter  New message filter value
+ ********************************************************************************/
+
+RTE_OPTIM_SIZE void rte_set_filter(const uint32_t filter)
+{
+    // The same filter value is set for the data logging structures of all CPU cores.
+    for (uint32_t core = 0U; core < RTE_RTEDBG_COUNT; core++)
+    {
+        rte_set_rtedbg_filter(RTE_CORE_RTEDBG(core), filter);
+    }
     RTE_DATA_MEMORY_BARRIER();          // Ensure visibility of changes across all CPU cores.
 }
 
 
+#if (RTE_CHANNELS) > 1U
+/********************************************************************************
+ * @brief Set the filter value of a single logging channel - see rte_set_filter().
+ *        Only the message groups routed to this channel are affected by the value.
+ *
+ * @param  channel  Logging channel number (0 ... RTE_CHANNELS - 1)
+ * @param  filter   New message filter value
+ ********************************************************************************/
+
+RTE_OPTIM_SIZE void rte_set_channel_filter(const uint32_t channel, const uint32_t filter)
+{
+    if (channel < (uint32_t)(RTE_CHANNELS))
+    {
+        rte_set_rtedbg_filter(RTE_CORE_RTEDBG(channel), filter);
+        RTE_DATA_MEMORY_BARRIER();      // Ensure visibility of changes across all CPU cores.
+    }
+}
+#endif // (RTE_CHANNELS) > 1U
+
+
 /********************************************************************************
  * @brief Restore the filter variable to the last non-zero value used before the
  *        filter variable was set to 0 by the firmware.
@@ -736,7 +1902,11 @@ RTE_OPTIM_SIZE void rte_set_filter(const uint32_t filter)
 
 RTE_OPTIM_SIZE void rte_restore_filter(void)
 {
-    g_rtedbg.filter = g_rtedbg.filter_copy;
+    for (uint32_t core = 0U; core < RTE_RTEDBG_COUNT; core++)
+    {
+        rtedbg_t *p_rtedbg = RTE_CORE_RTEDBG(core);
+        p_rtedbg->filter = p_rtedbg->filter_copy;
+    }
     RTE_DATA_MEMORY_BARRIER();          // Ensure visibility of changes across all CPU cores.
 }
 #endif // RTE_FIRMWARE_MAY_SET_FILTER != 0
@@ -746,13 +1916,534 @@ RTE_OPTIM_SIZE void rte_restore_filter(void)
  * @brief Retrieve the current value of the message filter.
  *
  * @return Current filter value (0 = filtering is completely disabled).
+ *         The value of the calling CPU core is returned if RTE_SMP_CORES > 1.
  ********************************************************************************/
 
 RTE_OPTIM_SIZE uint32_t rte_get_filter(void)
 {
     RTE_DATA_MEMORY_BARRIER();          // Ensure visibility of changes across all CPU cores.
-    return g_rtedbg.filter;
+    return RTE_LOCAL_RTEDBG()->filter;
+}
+
+
+#if RTE_GROUP_DECIMATION != 0
+/********************************************************************************
+ * @brief Set the decimation of a message group - only one of every 'divider'
+ *        messages of the group is logged. The next message of the group is logged.
+ *
+ * @param  group    Message group (filter number 0 ... 31)
+ * @param  divider  Log one of every 'divider' messages (0 or 1 = log all messages)
+ ********************************************************************************/
+
+RTE_OPTIM_SIZE void rte_set_decimation(const uint32_t group, const uint32_t divider)
+{
+    if (group < 32U)
+    {
+        g_rte_decimation.divider[group] = 0U;   // Disable during the counter reset
+        RTE_DATA_MEMORY_BARRIER();
+        g_rte_decimation.counter[group] = 0U;
+        g_rte_decimation.divider[group] = divider;
+        RTE_DATA_MEMORY_BARRIER();      // Ensure visibility of changes across all CPU cores.
+    }
+}
+#endif // RTE_GROUP_DECIMATION != 0
+
+
+#if RTE_TRIGGER_ENABLED != 0
+/********************************************************************************
+ * @brief Stop the message logging after the post-trigger data has been logged.
+ ********************************************************************************/
+
+RTE_OPTIM_SIZE static void rte_trigger_freeze(void)
+{
+    g_rte_trigger.remaining = 0U;
+    g_rte_trigger.state = RTE_TRIGGER_DONE;
+
+    for (uint32_t core = 0U; core < RTE_RTEDBG_COUNT; core++)
+    {
+        RTE_CORE_RTEDBG(core)->filter = 0U;
+    }
+    RTE_DATA_MEMORY_BARRIER();          // Ensure visibility of changes across all CPU cores.
+}
+
+
+/********************************************************************************
+ * @brief Start logging of the post-trigger data.
+ *
+ * @param  index  buf_index value at the trigger
+ ********************************************************************************/
+
+RTE_OPTIM_SIZE static void rte_trigger_start(const uint32_t index)
+{
+    g_rte_trigger.index = index;
+    g_rte_trigger.remaining = g_rte_trigger.post_words;
+    g_rte_trigger.state = RTE_TRIGGER_POST;
+
+    if (g_rte_trigger.post_words == 0U)
+    {
+        rte_trigger_freeze();
+    }
+}
+
+
+/********************************************************************************
+ * @brief Arm the trigger. The data is logged circularly until the trigger - the
+ *        rte_trigger() call or a message with the trigger format ID. The logging
+ *        stops automatically after post_words words have been logged after the
+ *        trigger (the triggering message is not counted).
+ *        Call this function after rte_init() - the filter must be enabled.
+ *
+ * @param  trigger_fmt  Format ID of the message that triggers the capture (e.g.
+ *                      MSG1_MOTOR_FAULT) or RTE_TRIGGER_NO_FMT
+ * @param  ext_mask     Extended data bits of the format ID - ignored in the compare,
+ *                      so that the message triggers the capture for any extended data
+ *                      value. Use the mask of the RTE_EXT_MSG macro (e.g. 7U for
+ *                      RTE_EXT_MSG0_3 or 15U for RTE_EXT_MSG1_3) or 0U for other messages.
+ * @param  post_words   Number of circular buffer words logged after the trigger
+ *                      (must be smaller than RTE_BUFFER_SIZE to keep pre-trigger data)
+ ********************************************************************************/
+
+RTE_OPTIM_SIZE void rte_trigger_arm(const uint32_t trigger_fmt, const uint32_t ext_mask,
+                                    const uint32_t post_words)
+{
+    g_rte_trigger.state = RTE_TRIGGER_OFF;
+    RTE_DATA_MEMORY_BARRIER();
+    g_rte_trigger.trigger_mask = ~ext_mask;
+    g_rte_trigger.trigger_fmt = trigger_fmt & ~ext_mask;
+    g_rte_trigger.post_words = post_words;
+    g_rte_trigger.remaining = post_words;
+    g_rte_trigger.index = 0U;
+    g_rte_trigger.state = RTE_TRIGGER_ARMED;
+    RTE_DATA_MEMORY_BARRIER();          // Ensure visibility of changes across all CPU cores.
+}
+
+
+/********************************************************************************
+ * @brief Trigger the capture from the firmware (e.g. from a fault handler).
+ *        Has no effect if the trigger is not armed.
+ ********************************************************************************/
+
+RTE_OPTIM_SIZE void rte_trigger(void)
+{
+    if (g_rte_trigger.state == RTE_TRIGGER_ARMED)
+    {
+        rte_trigger_start(RTE_LOCAL_RTEDBG()->buf_index);
+    }
+}
+
+
+/********************************************************************************
+ * @brief Check the trigger format ID or count the post-trigger words. Called by
+ *        the RTE_TRIGGER_CHECK() macro if the trigger mode is active.
+ *
+ * @param  fmt    Format ID of the logged message (not packed)
+ * @param  index  Index of the first word of the message
+ * @param  size   Message size (number of words)
+ ********************************************************************************/
+
+RTE_OPTIM_SPEED void __rte_trigger_check(const uint32_t fmt, const uint32_t index, const uint32_t size)
+{
+    const uint32_t state = g_rte_trigger.state;
+
+    if (state == RTE_TRIGGER_ARMED)
+    {
+        if ((fmt & g_rte_trigger.trigger_mask) == g_rte_trigger.trigger_fmt)
+        {
+            rte_trigger_start(index);
+        }
+    }
+    else if (state == RTE_TRIGGER_POST)
+    {
+        const uint32_t remaining = g_rte_trigger.remaining;
+        if (size >= remaining)
+        {
+            rte_trigger_freeze();
+        }
+        else
+        {
+            g_rte_trigger.remaining = remaining - size;
+        }
+    }
+    else
+    {
+        // RTE_TRIGGER_DONE - the message was reserved before the filter was cleared
+    }
+}
+#endif // RTE_TRIGGER_ENABLED != 0
+
+
+#if ((RTE_CACHE_LINE_SIZE) != 0U) && defined RTE_DCACHE_CLEAN
+/********************************************************************************
+ * @brief Write the data logged since the previous call from the data cache to the
+ *        memory, so that a debug probe or DMA that bypasses the cache reads the
+ *        actual contents of the circular buffer(s). Only the header and the part of
+ *        the buffer written since the previous call are cleaned with the
+ *        RTE_DCACHE_CLEAN() macro - not the complete g_rtedbg structure.
+ *        Call the function before a snapshot of the buffer is taken, e.g. before
+ *        the host is signaled that it can read the data or periodically from a
+ *        low priority task.
+ *
+ * @note   The part of the buffer cleaned also includes the last RTE_MAX_SUBPACKETS
+ *         subpackets before the position of the previous call. A message that was
+ *         still being written at that time (by an interrupted task) is thus cleaned
+ *         as well, if it has been completed in the meantime.
+ *
+ * @note   If RTE_WRITE_POSITION = 0, the function cannot detect that more than
+ *         RTE_BUFFER_SIZE words have been logged since the previous call. Call it
+ *         often enough in this case. With the free running write position, the
+ *         complete buffer is cleaned if the buffer has been filled since then.
+ *
+ * @note   The function must not be called from more than one task at the same time.
+ ********************************************************************************/
+
+RTE_OPTIM_SIZE void rte_dcache_clean(void)
+{
+    const uint32_t size = (uint32_t)(RTE_BUFFER_SIZE) + 4U;
+    // Longest message + trailer - the data logged before the previous call
+    const uint32_t overlap = ((uint32_t)(RTE_MAX_SUBPACKETS) * 5U) + 4U;
+
+    for (uint32_t core = 0U; core < RTE_RTEDBG_COUNT; core++)
+    {
+        rtedbg_t *p_rtedbg = RTE_CORE_RTEDBG(core);
+        const uint32_t index = p_rtedbg->buf_index;
+        const uint32_t last_index = rte_clean_index[core];
+        rte_clean_index[core] = index;
+
+        // Index of the first message logged after the previous call
+        uint32_t first = last_index;
+        RTE_LIMIT_INDEX(first)
+
+        // Number of words logged since then (the 4-word trailer is included if the data wraps)
+#if RTE_WRITE_POSITION != 0
+        uint32_t length = (index - last_index) + 4U;
+#else
+        uint32_t length;
+        if (index < first)
+        {
+            length = (index + size) - first;
+#if RTE_BUFF_SIZE_IS_POWER_OF_2 == 0
+            // The index has been reset to 0 - the end of the message that exceeded the
+            // buffer end may be in the words after the index
+            length += overlap;
+#endif
+        }
+        else if (index >= (uint32_t)(RTE_BUFFER_SIZE))
+        {
+            length = (index + 4U) - first;
+        }
+        else
+        {
+            length = index - first;
+        }
+#endif
+        length += overlap;
+        first = (first >= overlap) ? (first - overlap) : ((first + size) - overlap);
+
+        if (length >= size)
+        {
+            RTE_DCACHE_CLEAN(&p_rtedbg->buffer[0], size * sizeof(uint32_t));
+        }
+        else if ((first + length) <= size)
+        {
+            RTE_DCACHE_CLEAN(&p_rtedbg->buffer[first], length * sizeof(uint32_t));
+        }
+        else
+        {
+            RTE_DCACHE_CLEAN(&p_rtedbg->buffer[first], (size - first) * sizeof(uint32_t));
+            RTE_DCACHE_CLEAN(&p_rtedbg->buffer[0], ((first + length) - size) * sizeof(uint32_t));
+        }
+
+        RTE_DCACHE_CLEAN(p_rtedbg, RTE_HEADER_SIZE);
+    }
+}
+#endif // ((RTE_CACHE_LINE_SIZE) != 0U) && defined RTE_DCACHE_CLEAN
+
+
+#if RTE_FLASH_PERSIST != 0
+//! Last block of a data logging structure padded with erased words (if not a whole block)
+static uint32_t rte_flash_block[(uint32_t)(RTE_FLASH_BLOCK_SIZE) / 4U];
+
+/********************************************************************************
+ * @brief Program one block of the data logging structure image to the flash.
+ *        Blocks that contain only erased words are skipped - the flash is already
+ *        in that state.
+ *
+ * @param  flash_address  Flash address of the structure image
+ * @param  p_rtedbg       Data logging structure
+ * @param  block          Block number (0 = first block of the header)
+ *
+ * @return Number of bytes programmed
+ ********************************************************************************/
+
+RTE_OPTIM_SIZE static uint32_t rte_flash_program_block(const uintptr_t flash_address,
+                                                       const rtedbg_t * const p_rtedbg,
+                                                       const uint32_t block)
+{
+    const uint32_t block_words = (uint32_t)(RTE_FLASH_BLOCK_SIZE) / 4U;
+    const uint32_t *data = (const uint32_t *)(const void *)p_rtedbg + (block * block_words);
+    uint32_t words = ((uint32_t)sizeof(rtedbg_t) / 4U) - (block * block_words);
+
+    if (words > block_words)
+    {
+        words = block_words;
+    }
+
+    uint32_t i = 0U;
+    while ((i < words) && (data[i] == RTE_ERASED_STATE))
+    {
+        i++;
+    }
+
+    if (i >= words)
+    {
+        return 0U;      // Nothing to program
+    }
+
+    if (words < block_words)
+    {
+        // The structure ends inside of the block
+        for (i = 0U; i < words; i++)
+        {
+            rte_flash_block[i] = data[i];
+        }
+
+        for (; i < block_words; i++)
+        {
+            rte_flash_block[i] = RTE_ERASED_STATE;
+        }
+
+        data = rte_flash_block;
+    }
+
+    RTE_FLASH_PROGRAM(flash_address + (block * (uint32_t)(RTE_FLASH_BLOCK_SIZE)),
+                      data, (uint32_t)(RTE_FLASH_BLOCK_SIZE));
+    return (uint32_t)(RTE_FLASH_BLOCK_SIZE);
+}
+
+
+/********************************************************************************
+ * @brief Stop the message logging and write the data logging structure(s) to the
+ *        reserved flash area - e.g. from the HardFault handler or the watchdog early
+ *        warning interrupt, so that the post-mortem data is available even if no
+ *        debug probe was connected. The image has the same format as g_rtedbg. Read
+ *        it from the flash after the reset (e.g. with the debug probe or bootloader)
+ *        and decode it with RTEmsg like a g_rtedbg snapshot.
+ *        The header is written first, then the circular buffer blocks from the newest
+ *        data backwards. If the write is interrupted by the reset, the image already
+ *        contains the most recent messages. Blocks that are still in the erased state
+ *        (RTE_ERASED_STATE) - e.g. the unused part of the buffer after rte_init() or
+ *        in single-shot mode - are not programmed.
+ *
+ * @return Number of bytes programmed
+ *
+ * @note   The flash area must be erased before the function is called (erasing is too
+ *         slow for a fault handler). Check after the reset whether the area contains
+ *         an image, save or upload it and then erase the area.
+ *         Each image occupies sizeof(rtedbg_t) rounded up to RTE_FLASH_BLOCK_SIZE
+ *         bytes. The images of the CPU cores or logging channels (RTE_RTEDBG_COUNT)
+ *         follow each other.
+ *
+ * @note   The function is not reentrant. Messages logged by other CPU cores while
+ *         the filter is being set to zero may be incomplete in the image.
+ ********************************************************************************/
+
+RTE_OPTIM_SIZE uint32_t rte_flash_persist(void)
+{
+    const uint32_t block_words = (uint32_t)(RTE_FLASH_BLOCK_SIZE) / 4U;
+    const uint32_t header_words = (uint32_t)(RTE_HEADER_SIZE) / 4U;
+    const uint32_t blocks = (((uint32_t)sizeof(rtedbg_t) / 4U) + block_words - 1U) / block_words;
+    const uint32_t header_blocks = (header_words + block_words - 1U) / block_words;
+    uint32_t programmed = 0U;
+
+    // Freeze the contents of the circular buffers
+    for (uint32_t core = 0U; core < RTE_RTEDBG_COUNT; core++)
+    {
+        rtedbg_t *p_rtedbg = RTE_CORE_RTEDBG(core);
+        if (p_rtedbg->filter != 0U)
+        {
+            p_rtedbg->filter_copy = p_rtedbg->filter;
+        }
+        p_rtedbg->filter = 0U;
+    }
+    RTE_DATA_MEMORY_BARRIER();          // Ensure visibility of changes across all CPU cores.
+
+    for (uint32_t core = 0U; core < RTE_RTEDBG_COUNT; core++)
+    {
+        const rtedbg_t *p_rtedbg = RTE_CORE_RTEDBG(core);
+        const uintptr_t flash_address = (uintptr_t)(RTE_FLASH_ADDRESS)
+                                      + (core * blocks * (uint32_t)(RTE_FLASH_BLOCK_SIZE));
+#if ((RTE_CACHE_LINE_SIZE) != 0U) && defined RTE_DCACHE_CLEAN
+        RTE_DCACHE_CLEAN(p_rtedbg, sizeof(rtedbg_t));   // DMA may be used for programming
+#endif
+
+        for (uint32_t block = 0U; block < header_blocks; block++)
+        {
+            programmed += rte_flash_program_block(flash_address, p_rtedbg, block);
+        }
+
+        // Index of the next message - limited in the same way as by the logging functions
+        uint32_t index = p_rtedbg->buf_index;
+        RTE_LIMIT_INDEX(index)
+
+        // The block after the one containing the last logged word
+        uint32_t block = (header_words + index + block_words - 1U) / block_words;
+        if (block <= header_blocks)
+        {
+            block = blocks;
+        }
+
+        for (uint32_t i = header_blocks; i < blocks; i++)
+        {
+            block--;
+            programmed += rte_flash_program_block(flash_address, p_rtedbg, block);
+            if (block == header_blocks)
+            {
+                block = blocks;
+            }
+        }
+    }
+
+    return programmed;
+}
+#endif // RTE_FLASH_PERSIST != 0
+
+
+#if RTE_SHARED_RTEDBG != 0
+/********************************************************************************
+ * @brief Set the address of the data logging structure - e.g. of a shared memory
+ *        block mapped with mmap(), so that several processes can log to the same
+ *        circular buffer and a data collector process can read it without copying
+ *        the data. Call rte_init() after this function. The structure is only
+ *        initialized if it has not been initialized yet (e.g. by another process)
+ *        when rte_init() is called with RTE_CONTINUE_LOGGING.
+ *
+ * @param  address  Address of a block of rte_rtedbg_size() bytes (at least 4-byte
+ *                  aligned, cache line aligned if RTE_CACHE_LINE_SIZE != 0)
+ *
+ * @note   Call the function before any of the threads starts logging messages.
+ ********************************************************************************/
+
+RTE_OPTIM_SIZE void rte_set_rtedbg(void * const address)
+{
+    g_rte_shared_rtedbg = (rtedbg_t *)address;
+    RTE_DATA_MEMORY_BARRIER();      // Ensure visibility of changes across all CPU cores.
+}
+
+
+/********************************************************************************
+ * @brief Get the size of the data logging structure (header and circular buffer).
+ *
+ * @return Size of the memory block required by rte_set_rtedbg() [bytes]
+ ********************************************************************************/
+
+RTE_OPTIM_SIZE uint32_t rte_rtedbg_size(void)
+{
+    return (uint32_t)sizeof(rtedbg_t);
+}
+#endif // RTE_SHARED_RTEDBG != 0
+
+
+#if RTE_DUAL_BANK != 0
+/********************************************************************************
+ * @brief Swap the data logging banks. The inactive bank is erased and becomes the
+ *        active one. The host software can then read the previously active bank
+ *        (g_rte_bank_table.bank[active ^ 1]) at its own pace while the messages are
+ *        logged without a gap into the other bank. After reading it, the host sets
+ *        the read_count to swap_count and the bank can be reused by the next swap.
+ *        Call the function e.g. periodically or when the active bank is half full.
+ *
+ * @return 1 - banks swapped, 0 - the host has not read the inactive bank yet
+ *
+ * @note   Messages that were being logged by interrupted tasks at the moment of the
+ *         swap are completed in the old bank. The host should read the bank after
+ *         a delay longer than the time a task logging a message can be preempted.
+ *         The words reserved but not written yet are in the erased state - the
+ *         RTEmsg decoding software detects them.
+ *
+ * @note   The function must not be called from more than one task at the same time.
+ *         Logging continues in bank #0 after a reset.
+ ********************************************************************************/
+
+RTE_OPTIM_SIZE uint32_t rte_bank_swap(void)
+{
+    rte_bank_table_t * const p_table = &g_rte_bank_table;
+
+    if (p_table->read_count != p_table->swap_count)
+    {
+        return 0U;
+    }
+
+    const uint32_t new_bank = p_table->active ^ 1U;
+    const rtedbg_t * const p_old = p_table->bank[p_table->active];
+    rtedbg_t * const p_new = p_table->bank[new_bank];
+
+    // Prepare the inactive bank - the messages are still logged to the active one
+    p_new->filter = 0U;
+    rte_erase_buffer(p_new);
+    p_new->buf_index = 0U;
+#if RTE_LOSS_STATS != 0
+    p_new->too_long_count = 0U;
+    p_new->buffer_full_count = 0U;
+#endif
+    p_new->rte_cfg = p_old->rte_cfg;
+    p_new->timestamp_frequency = p_old->timestamp_frequency;
+    p_new->filter_copy = p_old->filter_copy;
+    p_new->filter = p_old->filter;
+#if ((RTE_CACHE_LINE_SIZE) != 0U) && defined RTE_DCACHE_CLEAN
+    rte_clean_index[new_bank] = 0U;
+    RTE_DCACHE_CLEAN(p_new, sizeof(rtedbg_t));
+#endif
+    RTE_DATA_MEMORY_BARRIER();          // The bank must be ready before it is used.
+
+    // Messages logged from now on are written to the new bank
+    p_table->active_bank = p_new;
+    p_table->active = new_bank;
+    RTE_DATA_MEMORY_BARRIER();          // Ensure visibility of changes across all CPU cores.
+    p_table->swap_count++;
+
+    // The new bank needs the long timestamp for the decoding of the message timestamps
+#if RTE_AUTO_LONG_TIMESTAMP != 0
+    RTE_MSG1(MSG1_LONG_TIMESTAMP, F_SYSTEM, RTE_LOCAL_LONG_TSTAMP() >> 1U)
+#elif RTE_USE_LONG_TIMESTAMP != 0
+    rte_long_timestamp();
+#endif
+    return 1U;
+}
+#endif // RTE_DUAL_BANK != 0
+
+
+#if RTE_AUTO_LONG_TIMESTAMP != 0
+/********************************************************************************
+ * @brief Update the automatic long timestamp state after the top bit of the message
+ *        timestamp has changed. The long timestamp message is logged when the
+ *        timestamp bits in the FMT words have wrapped around. The function is called
+ *        by the logging functions (see RTE_LONG_TIMESTAMP_CHECK()), so the firmware
+ *        does not have to call rte_long_timestamp() periodically.
+ *        Call it also from e.g. the timer overflow interrupt or a periodic task if
+ *        there can be no logged messages for more than half of the period of the
+ *        timestamp bits in the FMT words. Otherwise, a wrap around could be missed.
+ *
+ * @note  The function can be called from any task or interrupt. The state is updated
+ *        with a plain load and store (no atomic instructions). If a nested caller
+ *        (an interrupt) detects the same wrap around before the state is written,
+ *        the long timestamp message is logged twice. The decoding is not affected.
+ ********************************************************************************/
+
+RTE_OPTIM_SIZE void rte_long_timestamp_check(void)
+{
+    const uint32_t state = RTE_LOCAL_LONG_TSTAMP();     // Must be read before the counter
+    const uint32_t top_bit = (rte_get_timestamp() >> RTE_TSTAMP_TOP_BIT) & 1U;
+
+    if (((state ^ top_bit) & 1U) != 0U)
+    {
+        RTE_LOCAL_LONG_TSTAMP() = state + 1U;
+        if (top_bit == 0U)
+        {
+            RTE_MSG1(MSG1_LONG_TIMESTAMP, F_SYSTEM, (state + 1U) >> 1U)
+        }
+    }
 }
+#endif // RTE_AUTO_LONG_TIMESTAMP != 0
 
 
 /********************************************************************************
@@ -766,7 +2457,10 @@ RTE_OPTIM_SIZE uint32_t rte_get_filter(void)
 
 RTE_OPTIM_SIZE void rte_timestamp_frequency(const uint32_t new_frequency)
 {
-    g_rtedbg.timestamp_frequency = new_frequency;
+    for (uint32_t core = 0U; core < RTE_RTEDBG_COUNT; core++)
+    {
+        RTE_CORE_RTEDBG(core)->timestamp_frequency = new_frequency;
+    }
     RTE_MSG1(MSG1_TSTAMP_FREQUENCY, F_SYSTEM, new_frequency)
 }
 